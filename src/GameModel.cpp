@@ -35,6 +35,7 @@ THE SOFTWARE.
 #include "services/ContentKey.hpp"
 #include "services/ControllerInput.hpp"
 #include "services/KeyboardInput.hpp"
+#include "services/Replay.hpp"
 #include "services/Scoring.hpp"
 #include "services/ThreadPool.hpp"
 #include "systems/effects/BurnEffect.hpp"
@@ -44,12 +45,20 @@ THE SOFTWARE.
 #include "systems/effects/SinkEffect.hpp"
 
 #include <algorithm>
-#include <cassert>
+#include <atomic>
 #include <latch>
+#include <ranges>
 
 // Static member implementations
 std::shared_ptr<Level> GameModel::m_level{ nullptr };
 
+// Resolved once, these are played from inside of the update
+static const auto SOUND_RULE_CHANGED = Audio::getSoundId(content::KEY_AUDIO_RULE_CHANGED);
+static const auto SOUND_BURN = Audio::getSoundId(content::KEY_AUDIO_BURN);
+static const auto SOUND_SINK = Audio::getSoundId(content::KEY_AUDIO_SINK);
+
+static const std::string REPLAY_FILENAME = "last.replay";
+
 // --------------------------------------------------------------
 //
 // This is where all game model initialization occurs.
@@ -57,9 +66,11 @@ std::shared_ptr<Level> GameModel::m_level{ nullptr };
 // --------------------------------------------------------------
 void GameModel::initialize()
 {
-    // Busy wait for the content to finish loading.  It's okay, it is probably loaded by the time this is even encountered
-    while (Content::instance().anyPending())
-        ;
+    // Wait for the content to finish loading.  It's okay, it is probably loaded by the time this is even encountered
+    Content::instance().waitUntilLoaded();
+
+    // Every entity created while this level is played comes from its arena
+    m_arena = std::make_unique<entities::Arena>();
 
     m_sysMovement = std::make_unique<systems::Movement>(
         m_level,
@@ -70,7 +81,7 @@ void GameModel::initialize()
         },
         [this](entities::Entity::IdType entityId) // notifyUpdated
         {
-            m_updatedEntities.insert(entityId);
+            entityUpdated(entityId);
         });
     m_sysCompletion = std::make_unique<systems::Completion>(
         m_level,
@@ -88,7 +99,7 @@ void GameModel::initialize()
     m_sysHint = std::make_unique<systems::Hint>(
         [this](entities::Entity::IdType entityId)
         {
-            m_updatedEntities.insert(entityId);
+            entityUpdated(entityId);
         },
         [this](entities::Entity::IdType entityId)
         {
@@ -132,6 +143,20 @@ void GameModel::initialize()
     m_sysRendererChallenge = std::make_unique<systems::RendererChallenge>();
     m_sysRendererParticleSystem = std::make_unique<systems::RendererParticleSystem>();
 
+    // In the order they are drawn
+    m_hexGridRenderers = {
+        m_sysRendererHexGridStaticSprites.get(),
+        m_sysRendererHexGridAnimatedSprites.get(),
+        m_sysRendererHexGridOutline.get(),
+        m_sysRendererHexGridCoords.get(),
+        m_sysRendererPhraseDirection.get(),
+        m_sysRendererHexGridGoalHighlight.get(),
+        m_sysRendererHexGridSendHighlight.get(),
+        m_sysRendererHexGridIHighlight.get()
+    };
+    m_visibleCells = std::make_unique<systems::VisibleCells>(m_level);
+    m_renderPublished = false;
+
     m_sysCamera = std::make_unique<systems::Camera>(
         m_level->getWidth(),
         m_level->getHeight(),
@@ -201,13 +226,13 @@ void GameModel::initialize()
         },
         [this](entities::Entity::IdType entityId) // notifyUpdated
         {
-            m_updatedEntities.insert(entityId);
+            entityUpdated(entityId);
         },
         [this](const entities::EntitySet& ids) // notifyGoalChanged
         {
             if (!m_ruleChangedSoundPlayed)
             {
-                Audio::play(content::KEY_AUDIO_RULE_CHANGED, 70);
+                Audio::play(SOUND_RULE_CHANGED, 70);
                 m_ruleChangedSoundPlayed = true;
             }
             m_sysParticle->addEffect(std::make_unique<systems::RuleChangedEffect>(m_allEntities, ids, m_level->getWidth(), m_level->getHeight()));
@@ -216,7 +241,7 @@ void GameModel::initialize()
         {
             if (!m_ruleChangedSoundPlayed)
             {
-                Audio::play(content::KEY_AUDIO_RULE_CHANGED, 70);
+                Audio::play(SOUND_RULE_CHANGED, 70);
                 m_ruleChangedSoundPlayed = true;
             }
             m_sysParticle->addEffect(std::make_unique<systems::RuleChangedEffect>(m_allEntities, ids, m_level->getWidth(), m_level->getHeight()));
@@ -225,12 +250,34 @@ void GameModel::initialize()
         {
             if (!m_ruleChangedSoundPlayed)
             {
-                Audio::play(content::KEY_AUDIO_RULE_CHANGED, 70);
+                Audio::play(SOUND_RULE_CHANGED, 70);
                 m_ruleChangedSoundPlayed = true;
             }
             m_sysParticle->addEffect(std::make_unique<systems::NewPhraseEffect>(position, m_level->getWidth(), m_level->getHeight()));
         });
 
+    // The systems told about entity changes.  The camera only has the camera entity,
+    // while the hex grid outline and coords get all of theirs from the level, and the
+    // particle system renderer is its own separate thing, none of them are in here.
+    m_entitySystems = {
+        m_sysMovement.get(),
+        m_sysCompletion.get(),
+        m_sysAnimatedSprite.get(),
+        m_sysHint.get(),
+        m_sysChallenge.get(),
+        m_sysRendererHexGridAnimatedSprites.get(),
+        m_sysRendererHexGridStaticSprites.get(),
+        m_sysRendererPhraseDirection.get(),
+        m_sysRendererHexGridGoalHighlight.get(),
+        m_sysRendererHexGridSendHighlight.get(),
+        m_sysRendererHexGridIHighlight.get(),
+        m_sysRendererHint.get(),
+        m_sysRendererChallenge.get(),
+        m_sysUndo.get(),
+        m_sysRuleExecute.get(),
+        m_sysRuleSearch.get()
+    };
+
     // This has to come after creating all the systems, so that as the
     // entities are added (below), all the systems are up and ready to
     // do something with those entities
@@ -247,6 +294,37 @@ void GameModel::initialize()
     // Let's go ahead and discover and apply the rules before the first update
     m_sysRuleSearch->signalStateChange();
     m_sysRuleSearch->update(std::chrono::microseconds::zero());
+
+    startReplay();
+}
+
+// --------------------------------------------------------------
+//
+// If the developer has configured a replay for this level, start playing
+// it back, otherwise, start recording if asked to do so.  During playback
+// the input handlers for the game actions are removed, the camera is left
+// alone so the developer can still look around.
+//
+// --------------------------------------------------------------
+void GameModel::startReplay()
+{
+    m_replayBudget = std::chrono::microseconds::zero();
+
+    auto filename = Configuration::get<std::string>(config::DEVELOPER_REPLAY_PLAYBACK);
+    if (!filename.empty() && Replay::instance().startPlayback(filename))
+    {
+        if (Replay::instance().getLevelUUID() == m_level->getUUID())
+        {
+            unregisterInputHandlers();
+            return;
+        }
+        Replay::instance().stopPlayback();
+    }
+
+    if (Configuration::get<bool>(config::DEVELOPER_REPLAY_RECORD))
+    {
+        Replay::instance().startRecording(m_level->getUUID());
+    }
 }
 
 // --------------------------------------------------------------
@@ -257,6 +335,22 @@ void GameModel::initialize()
 // --------------------------------------------------------------
 void GameModel::shutdown()
 {
+    // Can't have the renderers preparing while everything is shut down
+    if (m_renderPrepared)
+    {
+        m_renderPrepared->wait();
+        m_renderPrepared.reset();
+    }
+
+    if (Replay::instance().isRecording())
+    {
+        Replay::instance().stopRecording(REPLAY_FILENAME);
+    }
+    if (Replay::instance().isPlaying())
+    {
+        Replay::instance().stopPlayback();
+    }
+
     m_sysCamera->shutdown();
     m_sysMovement->shutdown();
     m_sysCompletion->shutdown();
@@ -279,14 +373,93 @@ void GameModel::shutdown()
     m_sysUndo->shutdown();
     m_sysRuleExecute->shutdown();
     m_sysRuleSearch->shutdown();
+
+    // Leaving the level, all of its entities are freed in one shot
+    m_level->clear();
+    m_arena.reset();
 }
 
 // --------------------------------------------------------------
 //
-// This is where everything performs its update.
+// When a replay is playing, the recorded frames drive the simulation,
+// otherwise, the frame is marked for the recording (if any) and the
+// simulation steps forward by the real elapsed time.
+//
+// Once the tick is done, the hex grid renderers start preparing the
+// snapshot of it that is drawn by render.
 //
 // --------------------------------------------------------------
 void GameModel::update(const std::chrono::microseconds elapsedTime)
+{
+    // The snapshot of the previous tick has to be finished before the level changes again
+    publishRenderers();
+
+    if (Replay::instance().isPlaying())
+    {
+        playback(elapsedTime);
+    }
+    else
+    {
+        Replay::instance().beginFrame(elapsedTime);
+        simulate(elapsedTime);
+    }
+
+    prepareRenderers(elapsedTime);
+}
+
+// --------------------------------------------------------------
+//
+// Steps through as many recorded frames as the (scaled) real elapsed
+// time allows.  Each frame is simulated with the elapsed time it was
+// recorded with, so the result matches the original play through.  A
+// speed of 0 plays the remaining replay in a single update.
+//
+// --------------------------------------------------------------
+void GameModel::playback(const std::chrono::microseconds elapsedTime)
+{
+    auto speed = Configuration::get<float>(config::DEVELOPER_REPLAY_PLAYBACK_SPEED);
+    m_replayBudget += std::chrono::duration_cast<std::chrono::microseconds>(elapsedTime * speed);
+
+    while (Replay::instance().isPlaying() && (speed == 0 || m_replayBudget > std::chrono::microseconds::zero()))
+    {
+        auto frame = Replay::instance().nextFrame();
+        if (!frame)
+        {
+            Replay::instance().stopPlayback();
+            break;
+        }
+
+        for (auto&& event : frame->events)
+        {
+            switch (event.action)
+            {
+                case Replay::Action::Move:
+                case Replay::Action::MoveWithPull:
+                    m_sysMovement->signalMove(static_cast<misc::HexCoord::Direction>(event.value), event.action == Replay::Action::MoveWithPull);
+                    break;
+                case Replay::Action::Undo:
+                    m_sysUndo->signalUndo();
+                    break;
+                case Replay::Action::Reset:
+                    m_sysUndo->signalReset();
+                    break;
+                case Replay::Action::Camera:
+                    m_sysCamera->signalInput(static_cast<systems::Camera::Input>(event.value));
+                    break;
+            }
+        }
+
+        m_replayBudget -= frame->elapsedTime;
+        simulate(frame->elapsedTime);
+    }
+}
+
+// --------------------------------------------------------------
+//
+// This is where everything performs its update.
+//
+// --------------------------------------------------------------
+void GameModel::simulate(const std::chrono::microseconds elapsedTime)
 {
     std::latch graphDone{ 1 };
 
@@ -359,8 +532,12 @@ void GameModel::update(const std::chrono::microseconds elapsedTime)
                 // stay in a "rule execute -> rule search" loop until nothing changes, because
                 // the rule execute can only remove rules, not result in new rules being created...
                 m_sysRuleSearch->update(elapsedTime);
+                mergeCommands();
                 maxIterations--;
             } while (m_removeEntities.size() > 0 && maxIterations > 0);
+            // The rules just executed may have taken away (or given) the Goal and I properties, the
+            // completion system has to know about that before it checks for a completed level.
+            notifyUpdatedEntities();
 
             // This needs to be done only after all the rules have been updated and executed
             m_sysCompletion->update(elapsedTime);
@@ -405,6 +582,35 @@ void GameModel::update(const std::chrono::microseconds elapsedTime)
     m_ruleChangedSoundPlayed = false;
 }
 
+// --------------------------------------------------------------
+//
+// Each thread that records entity changes gets its own command buffer,
+// registered with the model under the lock the first time the thread
+// records anything.  The thread remembers which model its buffer belongs
+// to, so after that it finds the buffer without locking.
+//
+// --------------------------------------------------------------
+std::atomic_uint64_t GameModel::nextCommandsOwner{ 1 };
+
+GameModel::Commands& GameModel::commands()
+{
+    struct Registered
+    {
+        std::uint64_t owner{ 0 };
+        Commands* commands{ nullptr };
+    };
+    thread_local Registered registered;
+
+    if (registered.owner != m_commandsOwner)
+    {
+        std::lock_guard<std::mutex> lock(m_commandsMutex);
+        m_commands.push_back(std::make_unique<Commands>());
+        registered = { m_commandsOwner, m_commands.back().get() };
+    }
+
+    return *registered.commands;
+}
+
 // --------------------------------------------------------------
 //
 // This method is intended to be passed around to various systems as
@@ -414,33 +620,88 @@ void GameModel::update(const std::chrono::microseconds elapsedTime)
 // --------------------------------------------------------------
 void GameModel::addEntity(entities::EntityPtr entity)
 {
-    std::lock_guard<std::mutex> lock(m_mutexEntities);
-
-    m_newEntities.push_back(entity);
+    commands().spawn.push_back(entity);
 }
 
 // --------------------------------------------------------------
 //
-// Same as above, but for removing entities.
+// Same as above, but for removing entities.  The effect (if any) is
+// started when the removal is merged.
 //
 // --------------------------------------------------------------
 void GameModel::removeEntity(entities::Entity::IdType id, systems::ParticleEffect::Effect effect)
 {
-    std::lock_guard<std::mutex> lock(m_mutexEntities);
+    commands().despawn.push_back({ id, effect });
+}
+
+// --------------------------------------------------------------
+//
+// Systems report entity changes through this, possibly from different
+// threads at the same time.
+//
+// --------------------------------------------------------------
+void GameModel::entityUpdated(entities::Entity::IdType entityId)
+{
+    commands().updated.push_back(entityId);
+}
+
+// --------------------------------------------------------------
+//
+// Gathers the commands recorded by all threads since the last merge.
+// This is only called at the points in the frame where no other thread
+// is recording, the start of the frame, and between the dependent tasks
+// of the update.  The commands are put in entity id order, so the
+// result doesn't depend on which threads happened to record them.
+//
+// --------------------------------------------------------------
+void GameModel::mergeCommands()
+{
+    Commands merged;
+    {
+        std::lock_guard<std::mutex> lock(m_commandsMutex);
+        for (auto&& buffer : m_commands)
+        {
+            auto& commands = *buffer;
+            merged.spawn.insert(merged.spawn.end(), commands.spawn.begin(), commands.spawn.end());
+            merged.despawn.insert(merged.despawn.end(), commands.despawn.begin(), commands.despawn.end());
+            merged.updated.insert(merged.updated.end(), commands.updated.begin(), commands.updated.end());
+            commands.spawn.clear();
+            commands.despawn.clear();
+            commands.updated.clear();
+        }
+    }
 
-    assert(m_allEntities.contains(id));
+    std::ranges::stable_sort(merged.spawn, {}, [](const entities::EntityPtr& entity)
+                             {
+                                 return entity->getId();
+                             });
+    m_newEntities.insert(m_newEntities.end(), merged.spawn.begin(), merged.spawn.end());
 
-    if (m_allEntities[id]->hasComponent<components::Position>())
+    std::ranges::stable_sort(merged.despawn, {}, &Commands::Despawn::id);
+    for (auto&& [id, effect] : merged.despawn)
     {
-        auto& position = m_allEntities[id]->getComponent<components::Position>()->get();
+        // The entity may already be gone, e.g., despawned by more than one buffer in
+        // the same pass, or by something queued before an undo reset removed it
+        auto entity = m_allEntities.find(id);
+        if (entity == m_allEntities.end())
+        {
+            continue;
+        }
+        // Only the first removal of an entity gets to start an effect
+        if (!m_removeEntities.insert(id).second || !entity->second->hasComponent<components::Position>())
+        {
+            continue;
+        }
+
+        auto& position = entity->second->getComponent<components::Position>()->get();
         switch (effect)
         {
             case systems::ParticleEffect::Effect::EntityBurn:
-                Audio::play(content::KEY_AUDIO_BURN);
+                Audio::play(SOUND_BURN);
                 m_sysParticle->addEffect(std::make_unique<systems::BurnEffect>(position, m_level->getWidth(), m_level->getHeight()));
                 break;
             case systems::ParticleEffect::Effect::EntitySink:
-                Audio::play(content::KEY_AUDIO_SINK);
+                Audio::play(SOUND_SINK);
                 m_sysParticle->addEffect(std::make_unique<systems::SinkEffect>(position, m_level->getWidth(), m_level->getHeight()));
                 break;
             default:
@@ -449,7 +710,8 @@ void GameModel::removeEntity(entities::Entity::IdType id, systems::ParticleEffec
         }
     }
 
-    m_removeEntities.insert(id);
+    std::ranges::sort(merged.updated);
+    m_updatedEntities.insert(merged.updated.begin(), merged.updated.end());
 }
 
 // ------------------------------------------------------------------
@@ -467,36 +729,43 @@ void GameModel::clearEntitiesWithPosition()
         return entity.second->hasComponent<components::Position>();
     };
 
+    // Anything recorded so far is thrown away, but removals still get their effects
+    mergeCommands();
+
+    std::vector<entities::Entity::IdType> removed;
     for (auto&& removeMe : m_allEntities)
     {
         if (hasPosition(removeMe))
         {
-            m_level->removeEntity(removeMe.first);
-            m_sysMovement->removeEntity(removeMe.first);
-            m_sysCompletion->removeEntity(removeMe.first);
-            m_sysAnimatedSprite->removeEntity(removeMe.first);
-            m_sysHint->removeEntity(removeMe.first);
-            m_sysChallenge->removeEntity(removeMe.first);
-
-            m_sysRendererHexGridOutline->removeEntity(removeMe.first);
-            m_sysRendererHexGridCoords->removeEntity(removeMe.first);
-            m_sysRendererHexGridAnimatedSprites->removeEntity(removeMe.first);
-            m_sysRendererHexGridStaticSprites->removeEntity(removeMe.first);
-            m_sysRendererPhraseDirection->removeEntity(removeMe.first);
-            m_sysRendererHexGridGoalHighlight->removeEntity(removeMe.first);
-            m_sysRendererHexGridSendHighlight->removeEntity(removeMe.first);
-            m_sysRendererHexGridIHighlight->removeEntity(removeMe.first);
-            m_sysRendererHint->removeEntity(removeMe.first);
-            m_sysRendererChallenge->removeEntity(removeMe.first);
-
-            m_sysUndo->removeEntity(removeMe.first);
-            m_sysRuleExecute->removeEntity(removeMe.first);
-            m_sysRuleSearch->removeEntity(removeMe.first);
+            removed.push_back(removeMe.first);
         }
     }
 
-    // Now we need to remove them from the master container
-    std::erase_if(m_allEntities, hasPosition);
+    notifySystems(
+        [&removed](systems::System& system)
+        {
+            system.removeEntities(removed);
+        },
+        [this, &removed]()
+        {
+            for (auto&& entityId : removed)
+            {
+                m_level->removeEntity(entityId);
+            }
+        },
+        true);
+
+    // Now we need to remove them from the master container, after which no one is tracking them
+    // and their slots in the arena can be reused
+    for (auto&& entityId : removed)
+    {
+        m_arena->release(m_allEntities[entityId]);
+        m_allEntities.erase(entityId);
+    }
+    for (auto&& entity : m_newEntities)
+    {
+        m_arena->release(entity);
+    }
 
     m_newEntities.clear();
     m_removeEntities.clear();
@@ -542,41 +811,34 @@ void GameModel::clearAllEntities()
 // --------------------------------------------------------------
 void GameModel::addNewEntities()
 {
-    for (auto&& entity : m_newEntities)
+    mergeCommands();
+
+    entities::EntityVector added;
+    std::swap(added, m_newEntities);
+    if (added.empty())
     {
-        // Even though the level isn't a system, it still tracks entities
-        m_level->addEntity(entity);
+        return;
+    }
 
+    for (auto&& entity : added)
+    {
         m_allEntities[entity->getId()] = entity;
-
-        // NOTE: m_sysCamera only has a camera entity, does not need to execute here
-        m_sysMovement->addEntity(entity);
-        m_sysCompletion->addEntity(entity);
-        m_sysAnimatedSprite->addEntity(entity);
-        m_sysHint->addEntity(entity);
-        m_sysChallenge->addEntity(entity);
-
-        m_sysRendererHexGridAnimatedSprites->addEntity(entity);
-        m_sysRendererHexGridStaticSprites->addEntity(entity);
-        m_sysRendererPhraseDirection->addEntity(entity);
-        m_sysRendererHexGridGoalHighlight->addEntity(entity);
-        m_sysRendererHexGridSendHighlight->addEntity(entity);
-        m_sysRendererHexGridIHighlight->addEntity(entity);
-        m_sysRendererHint->addEntity(entity);
-        m_sysRendererChallenge->addEntity(entity);
-        // NOTE: The following systems don't track any entities, they get them all from
-        //       the level, therefore, do not need to be called here.
-        //
-        //       m_sysRendererHexGridOutline
-        //       m_sysRendererHexGridCoords
-
-        // NOTE: Particle system renderer does not have entities added to it, it is it's own separate thing
-
-        m_sysUndo->addEntity(entity);
-        m_sysRuleSearch->addEntity(entity);
-        m_sysRuleSearch->addEntity(entity);
     }
-    m_newEntities.clear();
+
+    notifySystems(
+        [&added](systems::System& system)
+        {
+            system.addEntities(added);
+        },
+        [this, &added]()
+        {
+            // Even though the level isn't a system, it still tracks entities
+            for (auto&& entity : added)
+            {
+                m_level->addEntity(entity);
+            }
+        },
+        true);
 }
 
 // --------------------------------------------------------------
@@ -587,44 +849,40 @@ void GameModel::addNewEntities()
 // --------------------------------------------------------------
 void GameModel::removeDeadEntities(bool undoAction)
 {
-    for (auto&& entityId : m_removeEntities)
+    mergeCommands();
+    if (m_removeEntities.empty())
     {
-        m_level->removeEntity(entityId);
+        return;
+    }
 
-        m_allEntities.erase(entityId);
+    std::vector<entities::Entity::IdType> removed(m_removeEntities.begin(), m_removeEntities.end());
+    m_removeEntities.clear();
 
-        // NOTE: m_sysCamera only has a camera entity, does not need to execute here
-        m_sysMovement->removeEntity(entityId);
-        m_sysCompletion->removeEntity(entityId);
-        m_sysAnimatedSprite->removeEntity(entityId);
-        m_sysHint->removeEntity(entityId);
-        m_sysChallenge->removeEntity(entityId);
-
-        m_sysRendererHexGridAnimatedSprites->removeEntity(entityId);
-        m_sysRendererHexGridStaticSprites->removeEntity(entityId);
-        m_sysRendererPhraseDirection->removeEntity(entityId);
-        m_sysRendererHexGridGoalHighlight->removeEntity(entityId);
-        m_sysRendererHexGridSendHighlight->removeEntity(entityId);
-        m_sysRendererHexGridIHighlight->removeEntity(entityId);
-        m_sysRendererHint->removeEntity(entityId);
-        m_sysRendererChallenge->removeEntity(entityId);
-        // NOTE: The following systems don't track any entities, they get them all from
-        //       the level, therefore, do not need to be called here.
-        //
-        //       m_sysRendererHexGridOutline
-        //       m_sysRendererHexGridCoords
-
-        if (!undoAction)
-        {
-            m_sysUndo->removeEntity(entityId);
-        }
-        m_sysRuleExecute->removeEntity(entityId);
-        m_sysRuleSearch->removeEntity(entityId);
+    // When the removal is the result of an undo, the undo system must not be told, otherwise
+    // it would add them right back in.
+    notifySystems(
+        [&removed](systems::System& system)
+        {
+            system.removeEntities(removed);
+        },
+        [this, &removed]()
+        {
+            for (auto&& entityId : removed)
+            {
+                m_level->removeEntity(entityId);
+            }
+        },
+        !undoAction);
+
+    for (auto&& entityId : removed)
+    {
+        // No system tracks it any longer, its slot in the arena can be reused
+        m_arena->release(m_allEntities[entityId]);
+        m_allEntities.erase(entityId);
 
         // In case this entity was also considered updated, remove it from the updated entities
         m_updatedEntities.erase(entityId);
     }
-    m_removeEntities.clear();
 }
 
 // --------------------------------------------------------------
@@ -635,6 +893,9 @@ void GameModel::removeDeadEntities(bool undoAction)
 // --------------------------------------------------------------
 void GameModel::notifyUpdatedEntities()
 {
+    mergeCommands();
+
+    entities::EntityVector updated;
     for (auto&& entityId : m_updatedEntities)
     {
         // There are some cases where entities get removed and updated at the same time.  It works
@@ -642,34 +903,53 @@ void GameModel::notifyUpdatedEntities()
         // everyone about it.
         if (m_allEntities.contains(entityId))
         {
-            // NOTE: m_sysCamera only has a camera entity, does not need to execute here
-            m_sysMovement->updatedEntity(m_allEntities[entityId]);
-            m_sysCompletion->updatedEntity(m_allEntities[entityId]);
-            m_sysAnimatedSprite->updatedEntity(m_allEntities[entityId]);
-            m_sysHint->updatedEntity(m_allEntities[entityId]);
-            m_sysChallenge->updatedEntity(m_allEntities[entityId]);
-
-            m_sysRendererHexGridAnimatedSprites->updatedEntity(m_allEntities[entityId]);
-            m_sysRendererHexGridStaticSprites->updatedEntity(m_allEntities[entityId]);
-            m_sysRendererPhraseDirection->updatedEntity(m_allEntities[entityId]);
-            m_sysRendererHexGridGoalHighlight->updatedEntity(m_allEntities[entityId]);
-            m_sysRendererHexGridSendHighlight->updatedEntity(m_allEntities[entityId]);
-            m_sysRendererHexGridIHighlight->updatedEntity(m_allEntities[entityId]);
-            m_sysRendererHint->updatedEntity(m_allEntities[entityId]);
-            m_sysRendererChallenge->updatedEntity(m_allEntities[entityId]);
-
-            // NOTE: The following systems don't track any entities, they get them all from
-            //       the level, therefore, do not need to be called here.
-            //
-            //       m_sysRendererHexGridOutline
-            //       m_sysRendererHexGridCoords
-
-            m_sysUndo->updatedEntity(m_allEntities[entityId]);
-            m_sysRuleExecute->updatedEntity(m_allEntities[entityId]);
-            m_sysRuleSearch->updatedEntity(m_allEntities[entityId]);
+            updated.push_back(m_allEntities[entityId]);
         }
     }
     m_updatedEntities.clear();
+    if (updated.empty())
+    {
+        return;
+    }
+
+    notifySystems(
+        [&updated](systems::System& system)
+        {
+            system.updatedEntities(updated);
+        },
+        [this, &updated]()
+        {
+            for (auto&& entity : updated)
+            {
+                m_level->updatedEntity(entity);
+            }
+        },
+        true);
+}
+
+// --------------------------------------------------------------
+//
+// The level and each of the systems that track entities only touch
+// their own state when told about entity changes, so all of them are
+// handed the whole batch of changes at the same time, spread across
+// the worker threads.
+//
+// --------------------------------------------------------------
+void GameModel::notifySystems(const std::function<void(systems::System&)>& notifySystem, const std::function<void()>& notifyLevel, bool includeUndo)
+{
+    ThreadPool::instance().parallelFor(
+        m_entitySystems.size() + 1,
+        [&](std::size_t which)
+        {
+            if (which == m_entitySystems.size())
+            {
+                notifyLevel();
+            }
+            else if (includeUndo || m_entitySystems[which] != m_sysUndo.get())
+            {
+                notifySystem(*m_entitySystems[which]);
+            }
+        });
 }
 
 // --------------------------------------------------------------
@@ -685,21 +965,21 @@ void GameModel::levelComplete(const Scoring::ChallengeGroup& score)
     {
         m_complete = true;
         unregisterInputHandlers();
-        Audio::play(content::KEY_AUDIO_LEVEL_COMPLETE);
+        Audio::play(content::KEY_AUDIO_LEVEL_COMPLETE, 100.0f, Audio::Priority::High);
 
         // Find out which challenge was met, then let the user know through the hint
         auto challenge = m_level->matchChallenge(score);
         if (challenge.has_value())
         {
             m_sysParticle->addEffect(std::make_unique<systems::LevelCompletedEffect>(m_level, systems::LevelCompletedEffect::Type::PreDefined));
-            auto hint = std::make_shared<entities::Entity>();
+            auto hint = entities::create();
             hint->addComponent(std::make_unique<components::Hint>("Challenge Complete - " + Scoring::formatChallengeFriendly(challenge.value()), misc::msTous(std::chrono::milliseconds(10000)), true));
             addEntity(hint);
         }
         else
         {
             m_sysParticle->addEffect(std::make_unique<systems::LevelCompletedEffect>(m_level, systems::LevelCompletedEffect::Type::BeyondCategory));
-            auto hint = std::make_shared<entities::Entity>();
+            auto hint = entities::create();
             hint->addComponent(std::make_unique<components::Hint>("You Found A Challenge!", misc::msTous(std::chrono::milliseconds(10000)), true));
             addEntity(hint);
         }
@@ -714,7 +994,7 @@ void GameModel::levelComplete(const Scoring::ChallengeGroup& score)
                 {
                     msgContinue = "{ A } Next " + msgContinue;
                 }
-                auto hint = std::make_shared<entities::Entity>();
+                auto hint = entities::create();
                 hint->addComponent(std::make_unique<components::Hint>(msgContinue, misc::msTous(std::chrono::milliseconds(500000))));
                 addEntity(hint);
             }
@@ -725,7 +1005,7 @@ void GameModel::levelComplete(const Scoring::ChallengeGroup& score)
                 {
                     msgContinue = "{ X } Next " + msgContinue;
                 }
-                auto hint = std::make_shared<entities::Entity>();
+                auto hint = entities::create();
                 hint->addComponent(std::make_unique<components::Hint>(msgContinue, misc::msTous(std::chrono::milliseconds(500000))));
                 addEntity(hint);
             }
@@ -737,7 +1017,7 @@ void GameModel::levelComplete(const Scoring::ChallengeGroup& score)
             {
                 msgContinue = "'SPACE' Next, " + msgContinue;
             }
-            auto hint = std::make_shared<entities::Entity>();
+            auto hint = entities::create();
             hint->addComponent(std::make_unique<components::Hint>(msgContinue, misc::msTous(std::chrono::milliseconds(500000))));
             addEntity(hint);
         }
@@ -755,26 +1035,84 @@ void GameModel::levelComplete(const Scoring::ChallengeGroup& score)
 
 // --------------------------------------------------------------
 //
-// All rendering takes place here.
+// All rendering takes place here.  Everything drawn is from the end of
+// the last tick: the hex grid renderers draw the snapshot they prepared
+// for it, and nothing changes the rest of the state until the next update.
 //
 // --------------------------------------------------------------
 void GameModel::render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime)
 {
+    // The very first frame may come before any update, so there isn't a snapshot yet
+    if (!m_renderPublished && !m_renderPrepared)
+    {
+        prepareRenderers(elapsedTime);
+    }
+    publishRenderers();
+
     // renderTarget.clear(sf::Color::White);
     renderTarget.clear(sf::Color::Black);
     // renderTarget.clear(sf::Color(238, 228, 253));
 
-    m_sysRendererHexGridStaticSprites->update(elapsedTime, renderTarget, m_sysCamera->getCamera());
-    m_sysRendererHexGridAnimatedSprites->update(elapsedTime, renderTarget, m_sysCamera->getCamera());
-    m_sysRendererHexGridOutline->update(elapsedTime, renderTarget, m_sysCamera->getCamera());
-    m_sysRendererHexGridCoords->update(elapsedTime, renderTarget, m_sysCamera->getCamera());
-    m_sysRendererPhraseDirection->update(elapsedTime, renderTarget, m_sysCamera->getCamera());
-    m_sysRendererHexGridGoalHighlight->update(elapsedTime, renderTarget, m_sysCamera->getCamera());
-    m_sysRendererHexGridSendHighlight->update(elapsedTime, renderTarget, m_sysCamera->getCamera());
-    m_sysRendererHexGridIHighlight->update(elapsedTime, renderTarget, m_sysCamera->getCamera());
+    for (auto&& renderer : m_hexGridRenderers)
+    {
+        renderer->render(renderTarget);
+    }
     m_sysRendererHint->update(elapsedTime, renderTarget);
     m_sysRendererChallenge->update(elapsedTime, renderTarget);
-    m_sysRendererParticleSystem->update(*m_sysParticle, renderTarget);
+    m_sysRendererParticleSystem->update(*m_sysParticle, renderTarget, elapsedTime);
+}
+
+// --------------------------------------------------------------
+//
+// Each hex grid renderer prepares the snapshot of the current state as
+// its own task on the workers, the snapshot is ready once the latch is
+// counted down.
+//
+// --------------------------------------------------------------
+void GameModel::prepareRenderers(const std::chrono::microseconds elapsedTime)
+{
+    m_renderPrepared = std::make_unique<std::latch>(1);
+    auto taskGraph = ThreadPool::instance().createTaskGraph(
+        [prepared = m_renderPrepared.get()]()
+        {
+            prepared->count_down();
+        });
+
+    // Figured out once here, rather than by every one of the renderers
+    m_visibleCells->update(m_sysCamera->getCamera());
+    for (auto&& renderer : m_hexGridRenderers)
+    {
+        ThreadPool::instance().createTask(
+            taskGraph,
+            [this, renderer, elapsedTime]()
+            {
+                renderer->prepare(elapsedTime, *m_visibleCells);
+            });
+    }
+
+    ThreadPool::instance().submitTaskGraph(taskGraph);
+}
+
+// --------------------------------------------------------------
+//
+// Waits for the snapshot being prepared, if there is one, and makes it
+// the one the hex grid renderers draw.
+//
+// --------------------------------------------------------------
+void GameModel::publishRenderers()
+{
+    if (!m_renderPrepared)
+    {
+        return;
+    }
+
+    m_renderPrepared->wait();
+    m_renderPrepared.reset();
+    for (auto&& renderer : m_hexGridRenderers)
+    {
+        renderer->publish();
+    }
+    m_renderPublished = true;
 }
 
 // --------------------------------------------------------------
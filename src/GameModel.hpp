@@ -48,9 +48,11 @@ THE SOFTWARE.
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Graphics.hpp>
 #include <SFML/Window/Event.hpp>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <functional>
+#include <latch>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -99,13 +101,38 @@ class GameModel
     std::unique_ptr<systems::RendererHint> m_sysRendererHint;
     std::unique_ptr<systems::RendererChallenge> m_sysRendererChallenge;
     std::unique_ptr<systems::RendererParticleSystem> m_sysRendererParticleSystem;
+    std::vector<systems::RendererHexGrid*> m_hexGridRenderers;
+    std::vector<systems::System*> m_entitySystems;
+    std::unique_ptr<systems::VisibleCells> m_visibleCells;
+    std::unique_ptr<std::latch> m_renderPrepared; // Set while the hex grid renderers prepare the snapshot of the last tick
+    bool m_renderPublished{ false };
 
-    std::mutex m_mutexEntities;
+    std::unique_ptr<entities::Arena> m_arena;
+
+    // Structural entity changes are recorded without locking, into a buffer owned
+    // by the recording thread, then merged at the sync points in the frame
+    struct alignas(64) Commands
+    {
+        struct Despawn
+        {
+            entities::Entity::IdType id;
+            systems::ParticleEffect::Effect effect;
+        };
+
+        entities::EntityVector spawn;
+        std::vector<Despawn> despawn;
+        std::vector<entities::Entity::IdType> updated;
+    };
+    static std::atomic_uint64_t nextCommandsOwner; // Identifies the model a thread's command buffer is registered with
+    std::uint64_t m_commandsOwner{ nextCommandsOwner++ };
+    std::mutex m_commandsMutex;
+    std::vector<std::unique_ptr<Commands>> m_commands;
     entities::EntityMap m_allEntities;
     std::vector<entities::EntityPtr> m_newEntities;
     std::unordered_set<entities::Entity::IdType> m_removeEntities;
     std::unordered_set<entities::Entity::IdType> m_updatedEntities;
     bool m_ruleChangedSoundPlayed{ false };
+    std::chrono::microseconds m_replayBudget{ 0 };
 
     void addEntity(entities::EntityPtr entity);
     void removeEntity(entities::Entity::IdType id, systems::ParticleEffect::Effect effect);
@@ -114,7 +141,16 @@ class GameModel
     void addNewEntities();
     void removeDeadEntities(bool undoAction);
     void notifyUpdatedEntities();
+    void notifySystems(const std::function<void(systems::System&)>& notifySystem, const std::function<void()>& notifyLevel, bool includeUndo);
+    void entityUpdated(entities::Entity::IdType entityId);
+    Commands& commands();
+    void mergeCommands();
     void levelComplete(const Scoring::ChallengeGroup& score);
+    void simulate(const std::chrono::microseconds elapsedTime);
+    void playback(const std::chrono::microseconds elapsedTime);
+    void startReplay();
+    void prepareRenderers(const std::chrono::microseconds elapsedTime);
+    void publishRenderers();
 
     void unregisterInputHandlers();
 };
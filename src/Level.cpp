@@ -23,10 +23,12 @@ THE SOFTWARE.
 #include "Level.hpp"
 
 #include "components/Ability.hpp"
+#include "components/AnimatedSprite.hpp"
 #include "components/Hint.hpp"
 #include "components/Noun.hpp"
 #include "components/Position.hpp"
 #include "components/Property.hpp"
+#include "components/StaticSprite.hpp"
 #include "components/Verb.hpp"
 #include "entities/Factory.hpp"
 #include "services/Configuration.hpp"
@@ -35,7 +37,7 @@ THE SOFTWARE.
 #include "services/ControllerInput.hpp"
 #include "services/Scoring.hpp"
 
-#include <algorithm> // std::transform
+#include <algorithm> // std::transform, std::ranges::fill
 #include <cassert>
 #include <cctype> // std::::toupper
 #include <charconv>
@@ -67,6 +69,18 @@ Level::Level(std::string name, std::string hint, std::string uuid, std::string c
         row.resize(width);
     }
 
+    m_summaries.resize(height);
+    for (auto&& row : m_summaries)
+    {
+        row.resize(width);
+    }
+
+    for (auto&& bitmap : m_occupancy)
+    {
+        bitmap.resize(static_cast<std::size_t>(height) * width);
+    }
+    m_occupancyCount.resize(static_cast<std::size_t>(height) * width);
+
     m_levelData.resize(layers);
 
     m_challenges = Scoring::parseChallenges(challenges);
@@ -159,7 +173,7 @@ void Level::initialize(std::function<void(entities::EntityPtr)> addEntity)
     {
         auto hintText{ m_hint };
         auto hintUpper{ m_hint };
-        auto hintEntity = std::make_shared<entities::Entity>();
+        auto hintEntity = entities::create();
         // First check for one of the built-in hints
         std::transform(hintUpper.begin(), hintUpper.end(), hintUpper.begin(),
                        [](unsigned char c)
@@ -219,11 +233,11 @@ void Level::initialize(std::function<void(entities::EntityPtr)> addEntity)
                 auto hintText2 = std::format("Camera Zoom {{ Right Joystick + R2 }}");
                 auto hintTime = misc::msTous(std::chrono::milliseconds(10000));
 
-                auto hint1Entity = std::make_shared<entities::Entity>();
+                auto hint1Entity = entities::create();
                 hint1Entity->addComponent(std::make_unique<components::Hint>(hintText1, hintTime));
                 addEntity(hint1Entity);
 
-                auto hint2Entity = std::make_shared<entities::Entity>();
+                auto hint2Entity = entities::create();
                 hint2Entity->addComponent(std::make_unique<components::Hint>(hintText2, hintTime));
                 addEntity(hint2Entity);
             }
@@ -279,6 +293,15 @@ void Level::clear()
             cell.clear();
         }
     }
+
+    for (auto&& bitmap : m_occupancy)
+    {
+        bitmap.reset();
+    }
+    std::ranges::fill(m_occupancyCount, std::array<std::uint16_t, static_cast<std::size_t>(Occupancy::SIZE)>{});
+    m_entityOccupancy.clear();
+
+    invalidateSummaries();
 }
 
 void Level::addEntity(entities::EntityPtr entity)
@@ -295,6 +318,12 @@ void Level::addEntity(entities::EntityPtr entity)
 
         // All
         m_entitiesAll[entity->getId()] = entity;
+
+        m_summaries[position->get().r][position->get().q].generation = 0;
+
+        auto categories = computeOccupancy(entity);
+        m_entityOccupancy[entity->getId()] = categories;
+        addOccupancy(position->get(), categories);
     }
 }
 
@@ -322,6 +351,96 @@ void Level::removeEntity(entities::Entity::IdType entityId)
 
         // All
         m_entitiesAll.erase(entityId);
+
+        m_summaries[position->get().r][position->get().q].generation = 0;
+
+        removeOccupancy(position->get(), m_entityOccupancy[entityId]);
+        m_entityOccupancy.erase(entityId);
+    }
+}
+
+void Level::updatedEntity(entities::EntityPtr entity)
+{
+    if (auto itr = m_entityOccupancy.find(entity->getId()); itr != m_entityOccupancy.end())
+    {
+        auto categories = computeOccupancy(entity);
+        if (categories != itr->second)
+        {
+            auto position = entity->getComponent<components::Position>()->get();
+            removeOccupancy(position, itr->second);
+            addOccupancy(position, categories);
+            itr->second = categories;
+        }
+    }
+}
+
+// --------------------------------------------------------------
+//
+// Returns a mask, one bit per Occupancy category, of the categories
+// the entity belongs to.  Every entity in the level is in Any.
+//
+// --------------------------------------------------------------
+std::uint8_t Level::computeOccupancy(const entities::EntityPtr& entity)
+{
+    auto mask = [](Occupancy category)
+    {
+        return static_cast<std::uint8_t>(1 << static_cast<std::uint8_t>(category));
+    };
+
+    std::uint8_t categories = mask(Occupancy::Any);
+    if (entity->getComponent<components::Object>()->getType() == components::ObjectType::Text)
+    {
+        categories |= mask(Occupancy::Text);
+    }
+    if (entity->hasComponent<components::Property>())
+    {
+        auto property = entity->getComponent<components::Property>();
+        if (property->has(components::PropertyType::I))
+        {
+            categories |= mask(Occupancy::I);
+        }
+        if (property->has(components::PropertyType::Goal))
+        {
+            categories |= mask(Occupancy::Goal);
+        }
+    }
+    if (entity->hasComponent<components::Ability>() && entity->getComponent<components::Ability>()->has(components::AbilityType::Send))
+    {
+        categories |= mask(Occupancy::Send);
+    }
+    if (entity->hasComponent<components::AnimatedSprite>())
+    {
+        categories |= mask(Occupancy::AnimatedSprite);
+    }
+    if (entity->hasComponent<components::StaticSprite>())
+    {
+        categories |= mask(Occupancy::StaticSprite);
+    }
+
+    return categories;
+}
+
+void Level::addOccupancy(const misc::HexCoord& cell, std::uint8_t categories)
+{
+    auto index = toOccupancyIndex(cell);
+    for (std::size_t category = 0; category < m_occupancy.size(); category++)
+    {
+        if ((categories & (1 << category)) && m_occupancyCount[index][category]++ == 0)
+        {
+            m_occupancy[category].set(index);
+        }
+    }
+}
+
+void Level::removeOccupancy(const misc::HexCoord& cell, std::uint8_t categories)
+{
+    auto index = toOccupancyIndex(cell);
+    for (std::size_t category = 0; category < m_occupancy.size(); category++)
+    {
+        if ((categories & (1 << category)) && --m_occupancyCount[index][category] == 0)
+        {
+            m_occupancy[category].reset(index);
+        }
     }
 }
 
@@ -336,7 +455,7 @@ const entities::EntityMap& Level::getEntities(const misc::HexCoord& cell) const
     return m_entitiesByHash[cell.r][cell.q];
 }
 
-Level::RenderOrderStorage Level::getEntitiesByRender(const misc::HexCoord& cell)
+const Level::RenderOrderStorage& Level::getEntitiesByRender(const misc::HexCoord& cell) const
 {
     assert(cell.r >= 0);
     assert(cell.r < this->getHeight());
@@ -346,6 +465,50 @@ Level::RenderOrderStorage Level::getEntitiesByRender(const misc::HexCoord& cell)
     return m_entitiesByRenderOrder[cell.r][cell.q];
 }
 
+// --------------------------------------------------------------
+//
+// Returns the movement summary for the cell, recomputing it first
+// if anything has changed since it was last computed.  Outside
+// of the level, the summary is empty.
+//
+// --------------------------------------------------------------
+const Level::CellSummary& Level::getSummary(const misc::HexCoord& cell)
+{
+    static const auto MOVEMENT_PROPERTIES =
+        static_cast<std::uint16_t>(components::PropertyType::Stop) |
+        static_cast<std::uint16_t>(components::PropertyType::Steep) |
+        static_cast<std::uint16_t>(components::PropertyType::Pushable) |
+        static_cast<std::uint16_t>(components::PropertyType::Pullable);
+
+    if (!this->isValid(cell))
+    {
+        static const CellSummary empty;
+        return empty;
+    }
+
+    auto& summary = m_summaries[cell.r][cell.q];
+    if (summary.generation != m_summaryGeneration)
+    {
+        summary.properties = 0;
+        summary.pushables = 0;
+        for (auto&& [id, entity] : m_entitiesByHash[cell.r][cell.q])
+        {
+            if (entity->hasComponent<components::Property>())
+            {
+                auto property = entity->getComponent<components::Property>();
+                summary.properties |= static_cast<std::uint16_t>(property->get()) & MOVEMENT_PROPERTIES;
+                if (property->has(components::PropertyType::Pushable))
+                {
+                    summary.pushables++;
+                }
+            }
+        }
+        summary.generation = m_summaryGeneration;
+    }
+
+    return summary;
+}
+
 void Level::moveEntity(entities::EntityPtr entity, misc::HexCoord previous)
 {
     //
@@ -379,6 +542,19 @@ void Level::moveEntity(entities::EntityPtr entity, misc::HexCoord previous)
     // Place it in it's new location
     auto renderOrder = entity->getComponent<components::Object>();
     m_entitiesByRenderOrder[position->get().r][position->get().q].insert({ renderOrder->getType(), entity });
+
+    //
+    // --------------- Summaries ---------------
+    //
+    m_summaries[previous.r][previous.q].generation = 0;
+    m_summaries[position->get().r][position->get().q].generation = 0;
+
+    //
+    // --------------- Occupancy ---------------
+    //
+    auto categories = m_entityOccupancy[entity->getId()];
+    removeOccupancy(previous, categories);
+    addOccupancy(position->get(), categories);
 }
 
 // --------------------------------------------------------------
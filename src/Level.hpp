@@ -23,16 +23,20 @@ THE SOFTWARE.
 #pragma once
 
 #include "components/Object.hpp"
+#include "components/Property.hpp"
 #include "entities/Entity.hpp"
+#include "misc/Bitset.hpp"
 #include "misc/HexCoord.hpp"
 #include "services/Scoring.hpp"
 
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <gtest/gtest_prod.h>
 #include <map>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class Level
@@ -42,6 +46,33 @@ class Level
     // well, they are rendered in the correct order.
     using RenderOrderStorage = std::multimap<components::ObjectType, entities::EntityPtr>;
 
+    // A summary of the movement related properties of all the entities in a cell, used
+    // to quickly decide if anything in the cell can stop, block, or be pushed/pulled.
+    struct CellSummary
+    {
+        std::uint16_t properties{ 0 }; // OR of the Stop, Steep, Pushable, Pullable properties
+        std::uint16_t pushables{ 0 };
+        std::uint32_t generation{ 0 };
+
+        bool has(components::PropertyType type) const { return properties & static_cast<std::uint16_t>(type); }
+    };
+
+    // The kinds of things the level keeps a bitmap of the cells they occupy, so
+    // that searches and renderers can visit only those cells.  A cell's bit
+    // is at r * width + q.
+    enum class Occupancy : std::uint8_t
+    {
+        Any,
+        Text,
+        I,
+        Goal,
+        Send,
+        AnimatedSprite,
+        StaticSprite,
+
+        SIZE // Must always be last to get the correct count
+    };
+
     Level(std::string name, std::string hint, std::string uuid, std::string challenges, std::uint8_t layers, std::uint16_t width, std::uint16_t height, misc::HexCoord cameraStartPos, std::uint8_t cameraStartRange);
 
     void initialize(std::function<void(entities::EntityPtr)> addEntity);
@@ -62,7 +93,14 @@ class Level
     void addEntity(entities::EntityPtr entity);
     void removeEntity(entities::Entity::IdType entityId);
     const entities::EntityMap& getEntities(const misc::HexCoord& cell) const;
-    RenderOrderStorage getEntitiesByRender(const misc::HexCoord& cell);
+    const RenderOrderStorage& getEntitiesByRender(const misc::HexCoord& cell) const;
+    const misc::Bitset& getOccupancy(Occupancy category) const { return m_occupancy[static_cast<std::size_t>(category)]; }
+    auto toOccupancyIndex(const misc::HexCoord& cell) const { return static_cast<std::size_t>(cell.r) * m_width + cell.q; }
+    // Entity properties, abilities, and sprites can change without the entity moving, whoever changes them has to tell the level
+    void updatedEntity(entities::EntityPtr entity);
+    const CellSummary& getSummary(const misc::HexCoord& cell);
+    // Properties are changed directly on the entities, so whoever changes them has to tell the level
+    void invalidateSummaries() { m_summaryGeneration++; }
 
     void moveEntity(entities::EntityPtr entity, misc::HexCoord previous);
 
@@ -110,6 +148,19 @@ class Level
     std::vector<std::vector<RenderOrderStorage>> m_entitiesByRenderOrder;
     // Used to lookup any entity, regardless of position - needed for removing entities
     entities::EntityMap m_entitiesAll;
+    // A cell summary is only valid when its generation matches this one, it is recomputed
+    // the next time it is asked for otherwise.
+    std::vector<std::vector<CellSummary>> m_summaries;
+    std::uint32_t m_summaryGeneration{ 1 };
+    // One bitmap per occupancy category, along with how many entities in each cell are counted in each category
+    std::array<misc::Bitset, static_cast<std::size_t>(Occupancy::SIZE)> m_occupancy;
+    std::vector<std::array<std::uint16_t, static_cast<std::size_t>(Occupancy::SIZE)>> m_occupancyCount;
+    // The categories each entity is currently counted in, needed to undo them when it is removed, moved, or updated
+    std::unordered_map<entities::Entity::IdType, std::uint8_t> m_entityOccupancy;
+
+    static std::uint8_t computeOccupancy(const entities::EntityPtr& entity);
+    void addOccupancy(const misc::HexCoord& cell, std::uint8_t categories);
+    void removeOccupancy(const misc::HexCoord& cell, std::uint8_t categories);
 
     void initialize(const std::vector<std::string>& levelData, std::function<void(entities::EntityPtr)> addEntity);
 };
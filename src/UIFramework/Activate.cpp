@@ -31,7 +31,7 @@ namespace ui
     {
         if (!m_active)
         {
-            Audio::play(content::KEY_MENU_ACTIVATE, 25);
+            Audio::play(content::KEY_MENU_ACTIVATE, 25, Audio::Priority::High);
             m_active = true;
         }
     }
@@ -157,7 +157,7 @@ namespace ui
     {
         m_onComplete(key);
         setKey(key);
-        Audio::play(content::KEY_MENU_ACCEPT);
+        Audio::play(content::KEY_MENU_ACCEPT, 100.0f, Audio::Priority::High);
         m_expectingInput = false;
     }
 
@@ -34,13 +34,17 @@ namespace components
     class AnimatedSprite : public PolymorphicComparable<Component, AnimatedSprite>
     {
       public:
-        AnimatedSprite(std::shared_ptr<sf::Texture> texture, std::uint8_t spriteCount, std::chrono::microseconds spriteTime, sf::Color spriteColor) :
+        //
+        // The texture rect is where the sprite sheet is in the texture, the whole
+        // texture unless the sheet is on an atlas page
+        AnimatedSprite(std::shared_ptr<sf::Texture> texture, sf::IntRect textureRect, std::uint8_t spriteCount, std::chrono::microseconds spriteTime, sf::Color spriteColor) :
             m_spriteCount(spriteCount),
             m_spriteTime(spriteTime),
             m_spriteColor(spriteColor)
         {
             m_sprite = std::make_shared<sf::Sprite>();
             m_sprite->setTexture(*texture);
+            m_sprite->setTextureRect(textureRect);
         }
 
         //
@@ -62,9 +66,10 @@ namespace components
         auto getCurrentSprite() { return m_currentSprite; }
         auto getCurrentSpriteRect()
         {
-            int width = (m_sprite->getTexture()->getSize().x / m_spriteCount);
-            int left = m_currentSprite * width;
-            return sf::IntRect({ left, 0, width, static_cast<int>(m_sprite->getTexture()->getSize().y) });
+            auto sheet = m_sprite->getTextureRect();
+            int width = (sheet.width / m_spriteCount);
+            int left = sheet.left + m_currentSprite * width;
+            return sf::IntRect({ left, sheet.top, width, sheet.height });
         }
         auto incrementSprite() { m_currentSprite = (m_currentSprite + 1) % m_spriteCount; }
         void resetAnimation()
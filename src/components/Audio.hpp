@@ -23,6 +23,7 @@ THE SOFTWARE.
 #pragma once
 
 #include "Component.hpp"
+#include "services/Audio.hpp"
 #include "services/Content.hpp"
 
 #include <SFML/Audio/Sound.hpp>
@@ -34,11 +35,13 @@ namespace components
     {
       public:
         Audio(std::string audioKey) :
-            m_audioKey(audioKey)
+            m_audioKey(audioKey),
+            m_soundId(::Audio::getSoundId(audioKey))
         {
         }
 
         auto getKey() { return m_audioKey; }
+        auto getSoundId() { return m_soundId; }
 
         virtual std::tuple<ctti::unnamed_type_id_t, std::unique_ptr<Component>> clone() override
         {
@@ -52,5 +55,6 @@ namespace components
 
       private:
         std::string m_audioKey;
+        ::Audio::SoundId m_soundId;
     };
 } // namespace components
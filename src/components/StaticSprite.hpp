@@ -33,13 +33,17 @@ namespace components
     class StaticSprite : public PolymorphicComparable<Component, StaticSprite>
     {
       public:
-        StaticSprite(std::shared_ptr<sf::Texture> texture, sf::Color spriteColor) :
+        //
+        // The texture rect is where the image is in the texture, the whole
+        // texture unless the image is on an atlas page
+        StaticSprite(std::shared_ptr<sf::Texture> texture, sf::IntRect textureRect, sf::Color spriteColor) :
             m_spriteColor(spriteColor)
         {
             m_sprite = std::make_shared<sf::Sprite>();
             m_sprite->setTexture(*texture);
-            // Point about which drawing, rotation, etc takes place, the center of the texture
-            m_sprite->setOrigin({ texture->getSize().x / 2.0f, texture->getSize().y / 2.0f });
+            m_sprite->setTextureRect(textureRect);
+            // Point about which drawing, rotation, etc takes place, the center of the image
+            m_sprite->setOrigin({ textureRect.width / 2.0f, textureRect.height / 2.0f });
         }
 
         //
@@ -54,7 +58,7 @@ namespace components
         auto getSpriteColor() { return m_spriteColor; }
         auto getCurrentSpriteRect()
         {
-            return sf::IntRect({ 0, 0, static_cast<int>(m_sprite->getTexture()->getSize().x), static_cast<int>(m_sprite->getTexture()->getSize().y) });
+            return m_sprite->getTextureRect();
         }
 
         virtual std::tuple<ctti::unnamed_type_id_t, std::unique_ptr<Component>> clone() override
@@ -23,10 +23,103 @@ THE SOFTWARE.
 #include "Entity.hpp"
 
 #include <memory>
+#include <stdexcept>
 
 namespace entities
 {
     std::atomic_uint32_t Entity::nextId = 0;
+    Arena* Arena::m_current{ nullptr };
+
+    Arena::Arena() :
+        m_previous(m_current)
+    {
+        m_current = this;
+    }
+
+    // --------------------------------------------------------------
+    //
+    // All of the entities go away with their chunks, any handles still
+    // out there no longer resolve to anything.
+    //
+    // --------------------------------------------------------------
+    Arena::~Arena()
+    {
+        m_chunkCount = 0;
+        if (m_current == this)
+        {
+            m_current = m_previous;
+        }
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Reuse the longest released slot if there is one, otherwise take the
+    // next unused slot, adding a new chunk when the last one is full.  Running
+    // out of slots is not something a level can recover from, so it throws
+    // rather than handing out a handle that aliases another entity.
+    //
+    // --------------------------------------------------------------
+    EntityPtr Arena::create()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::uint32_t index{ 0 };
+        if (!m_free.empty())
+        {
+            index = m_free.front();
+            m_free.pop_front();
+        }
+        else
+        {
+            if (m_nextUnused == MAX_CHUNKS * CHUNK_SIZE)
+            {
+                throw std::length_error("entity arena is exhausted");
+            }
+            index = m_nextUnused++;
+            if ((index >> CHUNK_BITS) == m_chunkCount.load())
+            {
+                m_chunks[index >> CHUNK_BITS] = std::make_unique<Slot[]>(CHUNK_SIZE);
+                m_chunkCount.store(m_chunkCount.load() + 1, std::memory_order_release);
+            }
+        }
+
+        // The entity must be in place before the generation that makes it resolvable
+        auto& slot = m_chunks[index >> CHUNK_BITS][index & (CHUNK_SIZE - 1)];
+        slot.entity.emplace();
+        auto generation = slot.generation.load() + 1;
+        slot.generation.store(generation, std::memory_order_release);
+        m_live++;
+
+        return EntityPtr((static_cast<Handle>(generation) << INDEX_BITS) | index);
+    }
+
+    // --------------------------------------------------------------
+    //
+    // The slot is moved to the next generation before the entity is
+    // destroyed, so nothing can resolve the handle while that happens.
+    // Releasing a handle that no longer resolves does nothing.
+    //
+    // --------------------------------------------------------------
+    void Arena::release(const EntityPtr& entity)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (get(entity.getHandle()) == nullptr)
+        {
+            return;
+        }
+
+        auto index = static_cast<std::uint32_t>(entity.getHandle());
+        auto& slot = m_chunks[index >> CHUNK_BITS][index & (CHUNK_SIZE - 1)];
+        auto generation = slot.generation.load() + 1;
+        slot.generation.store(generation, std::memory_order_release);
+        slot.entity.reset();
+        if (generation < MAX_GENERATION)
+        {
+            m_free.push_back(index);
+        }
+        m_live--;
+    }
 
     // --------------------------------------------------------------
     //
@@ -36,7 +129,7 @@ namespace entities
     // --------------------------------------------------------------
     entities::EntityPtr Entity::clone()
     {
-        auto clone = std::make_shared<Entity>();
+        auto clone = create();
 
         //
         // Need the exact same id, and o boy, be careful with the clone, don't mix
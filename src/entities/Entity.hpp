@@ -40,18 +40,27 @@ THE SOFTWARE.
 #if defined(_MSC_VER)
     #pragma warning(pop)
 #endif
+#include <array>
 #include <atomic>
 #include <cassert>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 namespace entities
 {
+    class EntityPtr;
+
     // --------------------------------------------------------------
     //
     // An Entity is a collection of components.
@@ -62,7 +71,7 @@ namespace entities
     // associative containers.
     //
     // --------------------------------------------------------------
-    class Entity : public std::enable_shared_from_this<Entity>
+    class Entity
     {
       private:
         static std::atomic_uint32_t nextId; // Each entity needs a unique id, using a static to do this.
@@ -92,7 +101,7 @@ namespace entities
 
         auto& getComponents() { return m_components; }
 
-        std::shared_ptr<entities::Entity> clone();
+        EntityPtr clone();
         bool operator==(const Entity& rhs);
         bool operator!=(const Entity& rhs);
 
@@ -101,8 +110,145 @@ namespace entities
         std::unordered_map<ctti::unnamed_type_id_t, std::unique_ptr<components::Component>> m_components;
     };
 
+    // --------------------------------------------------------------
+    //
+    // Entities are allocated from an arena owned by the level being
+    // played, and referenced through 64-bit generational handles.  The
+    // low 32 bits of a handle are the slot index, the high 32 bits are the
+    // generation of the slot when the entity was created.  A slot holds a
+    // live entity only while its generation is odd; creating an entity
+    // and releasing it each move the slot to the next generation, so any
+    // handle still referring to a released entity no longer resolves.
+    //
+    // Released slots are reused oldest first, and a slot whose generation
+    // would wrap is retired instead of reused, so a stale handle can never
+    // come back to life as a different entity.
+    //
+    // Slots are allocated in fixed size chunks that never move, so a
+    // handle resolves to its entity in O(1) without locking, only creating
+    // and releasing entities take the lock.  Destroying the arena frees
+    // every entity it holds in one shot.
+    //
+    // An arena makes itself the current arena when constructed and all
+    // handles resolve through it, the previous arena becomes current
+    // again when it is destroyed.
+    //
+    // --------------------------------------------------------------
+    class Arena
+    {
+      public:
+        using Handle = std::uint64_t;
+        static constexpr Handle NONE{ 0 };
+
+        Arena();
+        ~Arena();
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        static Arena& current()
+        {
+            assert(m_current != nullptr);
+            return *m_current;
+        }
+
+        EntityPtr create();
+        void release(const EntityPtr& entity);
+        Entity* get(Handle handle) const;
+        std::size_t size() const { return m_live.load(); }
+
+      private:
+        static constexpr std::uint32_t INDEX_BITS{ 32 };
+        static constexpr std::uint32_t CHUNK_BITS{ 10 };
+        static constexpr std::uint32_t CHUNK_SIZE{ 1u << CHUNK_BITS };
+        static constexpr std::uint32_t MAX_CHUNKS{ 1u << 10 };
+        static constexpr std::uint32_t MAX_GENERATION{ std::numeric_limits<std::uint32_t>::max() - 1 };
+
+        struct Slot
+        {
+            std::atomic_uint32_t generation{ 0 }; // Even while the slot is free, so NONE never resolves
+            std::optional<Entity> entity;
+        };
+
+        static Arena* m_current;
+
+        Arena* m_previous{ nullptr };
+        std::mutex m_mutex;
+        std::array<std::unique_ptr<Slot[]>, MAX_CHUNKS> m_chunks;
+        std::atomic_uint32_t m_chunkCount{ 0 };
+        std::uint32_t m_nextUnused{ 0 };
+        std::deque<std::uint32_t> m_free;
+        std::atomic_size_t m_live{ 0 };
+    };
+
+    // --------------------------------------------------------------
+    //
+    // Handle to an entity in the current arena.  It is the size of the
+    // handle, copying it doesn't touch any reference count, and it can
+    // be used like a pointer to the entity.  Dereferencing a handle that
+    // no longer resolves throws, rather than handing back a null entity.
+    //
+    // --------------------------------------------------------------
+    class EntityPtr
+    {
+      public:
+        EntityPtr() = default;
+        EntityPtr(std::nullptr_t) {}
+        explicit EntityPtr(Arena::Handle handle) :
+            m_handle(handle)
+        {
+        }
+
+        Entity* get() const { return m_handle != Arena::NONE ? Arena::current().get(m_handle) : nullptr; }
+        Entity* operator->() const
+        {
+            auto entity = get();
+            if (entity == nullptr)
+            {
+                throw std::logic_error("entity handle does not resolve to a live entity");
+            }
+            return entity;
+        }
+        Entity& operator*() const { return *operator->(); }
+        explicit operator bool() const { return get() != nullptr; }
+
+        bool operator==(const EntityPtr& rhs) const { return m_handle == rhs.m_handle; }
+        bool operator==(std::nullptr_t) const { return m_handle == Arena::NONE; }
+
+        auto getHandle() const { return m_handle; }
+
+      private:
+        Arena::Handle m_handle{ Arena::NONE };
+    };
+
+    // --------------------------------------------------------------
+    //
+    // Resolving a handle is an index into its chunk and a check the slot
+    // still holds the generation the handle was created with.  The entity
+    // is in place before its generation is published, and the generation
+    // moves on before the entity is destroyed, so a matching generation
+    // always means a live entity.
+    //
+    // --------------------------------------------------------------
+    inline Entity* Arena::get(Handle handle) const
+    {
+        auto index = static_cast<std::uint32_t>(handle);
+        auto generation = static_cast<std::uint32_t>(handle >> INDEX_BITS);
+        if ((generation & 1) == 0 || (index >> CHUNK_BITS) >= m_chunkCount.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+        auto& slot = m_chunks[index >> CHUNK_BITS][index & (CHUNK_SIZE - 1)];
+
+        return slot.generation.load(std::memory_order_acquire) == generation ? &slot.entity.value() : nullptr;
+    }
+
+    // All new entities come from the current arena
+    inline EntityPtr create()
+    {
+        return Arena::current().create();
+    }
+
     // Convenience type aliases for use throughout the framework
-    using EntityPtr = std::shared_ptr<Entity>;
     using EntityMap = std::unordered_map<Entity::IdType, EntityPtr>;
     using EntitySet = std::unordered_set<Entity::IdType>;
     using EntityVector = std::vector<EntityPtr>;
@@ -162,16 +308,17 @@ namespace std
 
     // --------------------------------------------------------------
     //
-    // Hash function for entities::Entity, to allow it to be used in
-    // std:: containers where a hash function is needed.
+    // Hash function for entities::EntityPtr, to allow it to be used in
+    // std:: containers where a hash function is needed.  The handle is
+    // unique among the live entities, so there is no need to resolve it.
     //
     // --------------------------------------------------------------
     template <>
-    struct hash<shared_ptr<entities::Entity>>
+    struct hash<entities::EntityPtr>
     {
         size_t operator()(const entities::EntityPtr& v) const noexcept
         {
-            return v->getId();
+            return std::hash<entities::Arena::Handle>{}(v.getHandle());
         }
     };
 } // namespace std
\ No newline at end of file
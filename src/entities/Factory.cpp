@@ -38,14 +38,115 @@ THE SOFTWARE.
 #include "services/ContentKey.hpp"
 
 #include <SFML/Graphics.hpp>
+#include <array>
 #include <cassert>
 #include <string>
 
 namespace entities
 {
-    std::shared_ptr<Entity> createEntity(misc::HexCoord position, std::function<void(entities::EntityPtr)> apply)
+    namespace
     {
-        auto entity = std::make_shared<entities::Entity>();
+        // --------------------------------------------------------------
+        //
+        // Every entity of a kind has the same sprite color, so the colors are
+        // resolved once, when the factory is first initialized, into a table
+        // indexed the same way the renderers index their sprite buffers.  The
+        // table is never written after that, so any thread can read from it.
+        //
+        // --------------------------------------------------------------
+        const std::array<sf::Color, components::Object::TYPE_SIZE>& getSpriteColors()
+        {
+            static const auto colors = []()
+            {
+                using namespace components;
+
+                std::array<sf::Color, Object::TYPE_SIZE> colors;
+                auto resolve = [&colors](Object object, const std::string& keyDOM)
+                {
+                    colors[object.renderSequence()] = Configuration::get<sf::Color>({ config::DOM_CONTENT, config::DOM_LEVELS, config::DOM_IMAGES_OBJECTS, keyDOM, config::DOM_SPRITE_COLOR });
+                };
+
+                resolve({ ObjectType::Background_White }, "background_white");
+                resolve({ ObjectType::Background_Purple }, "background_purple");
+                resolve({ ObjectType::Background_Grey }, "background_grey");
+                resolve({ ObjectType::Background_Green }, "background_green");
+                resolve({ ObjectType::Background_Blue }, "background_blue");
+                resolve({ ObjectType::Background_Red }, "background_red");
+                resolve({ ObjectType::Background_Brown }, "background_brown");
+                resolve({ ObjectType::Background_Yellow }, "background_yellow");
+
+                resolve({ ObjectType::Floor }, "floor");
+                resolve({ ObjectType::Wall }, "wall");
+                resolve({ ObjectType::Purple }, "purple");
+                resolve({ ObjectType::Grey }, "grey");
+                resolve({ ObjectType::Green }, "green");
+                resolve({ ObjectType::Blue }, "blue");
+                resolve({ ObjectType::Red }, "red");
+                resolve({ ObjectType::Brown }, "brown");
+                resolve({ ObjectType::Yellow }, "yellow");
+                resolve({ ObjectType::Black }, "black");
+                resolve({ ObjectType::Grass }, "grass");
+                resolve({ ObjectType::Flowers }, "flowers");
+
+                resolve({ ObjectType::Text, TextType::Text_Is }, "text-is");
+                resolve({ ObjectType::Text, TextType::Text_Am }, "text-am");
+                resolve({ ObjectType::Text, TextType::Text_Can }, "text-can");
+                resolve({ ObjectType::Text, TextType::Text_And }, "text-and");
+                resolve({ ObjectType::Text, TextType::Text_Goal }, "text-goal");
+                resolve({ ObjectType::Text, TextType::Text_Climb }, "text-climb");
+                resolve({ ObjectType::Text, TextType::Text_Float }, "text-float");
+                resolve({ ObjectType::Text, TextType::Text_Push }, "text-push");
+                resolve({ ObjectType::Text, TextType::Text_Pull }, "text-pull");
+                resolve({ ObjectType::Text, TextType::Text_Stop }, "text-stop");
+                resolve({ ObjectType::Text, TextType::Text_Hot }, "text-hot");
+                resolve({ ObjectType::Text, TextType::Text_Send }, "text-send");
+                resolve({ ObjectType::Text, TextType::Text_I }, "text-i");
+                resolve({ ObjectType::Text, TextType::Text_Word }, "text-word");
+                resolve({ ObjectType::Text, TextType::Text_Wall }, "text-wall");
+                resolve({ ObjectType::Text, TextType::Text_Floor }, "text-floor");
+                resolve({ ObjectType::Text, TextType::Text_Flowers }, "text-flowers");
+                resolve({ ObjectType::Text, TextType::Text_Grass }, "text-grass");
+                resolve({ ObjectType::Text, TextType::Text_Purple }, "text-purple");
+                resolve({ ObjectType::Text, TextType::Text_Grey }, "text-grey");
+                resolve({ ObjectType::Text, TextType::Text_Green }, "text-green");
+                resolve({ ObjectType::Text, TextType::Text_Blue }, "text-blue");
+                resolve({ ObjectType::Text, TextType::Text_Red }, "text-red");
+                resolve({ ObjectType::Text, TextType::Text_Brown }, "text-brown");
+                resolve({ ObjectType::Text, TextType::Text_Yellow }, "text-yellow");
+                resolve({ ObjectType::Text, TextType::Text_Black }, "text-black");
+
+                return colors;
+            }();
+
+            return colors;
+        }
+
+        sf::Color getSpriteColor(components::Object object)
+        {
+            return getSpriteColors()[object.renderSequence()];
+        }
+
+        std::unique_ptr<components::AnimatedSprite> createAnimatedSprite(const std::string& keyLevel, const std::string& keyDOM, const std::string& keyContent, sf::Color spriteColor)
+        {
+            using namespace config;
+
+            const config_path SPRITE_COUNT = { DOM_CONTENT, DOM_LEVELS, keyLevel, keyDOM, DOM_SPRITE_COUNT };
+            const config_path SPRITE_TIME = { DOM_CONTENT, DOM_LEVELS, keyLevel, keyDOM, DOM_SPRITE_TIME };
+
+            auto spriteCount = Configuration::get<std::uint8_t>(SPRITE_COUNT);
+            auto spriteTime = misc::msTous(Configuration::get<std::chrono::milliseconds>(SPRITE_TIME));
+            auto texture = Content::get<sf::Texture>(keyContent);
+
+            auto sprite = std::make_unique<components::AnimatedSprite>(texture, Content::getTextureRect(keyContent), spriteCount, spriteTime, spriteColor);
+            sprite->getSprite()->setScale(math::getViewScale({ static_cast<float>(sprite->getSpriteCount()), 1.0f }, sprite->getSprite()->getTextureRect()));
+
+            return sprite;
+        }
+    } // namespace
+
+    EntityPtr createEntity(misc::HexCoord position, std::function<void(entities::EntityPtr)> apply)
+    {
+        auto entity = entities::create();
 
         entity->addComponent(std::make_unique<components::Position>(position));
         apply(entity);
@@ -53,34 +154,26 @@ namespace entities
         return entity;
     };
 
-    std::shared_ptr<Entity> createCamera(misc::HexCoord center, std::uint8_t range)
+    EntityPtr createCamera(misc::HexCoord center, std::uint8_t range)
     {
-        auto entity = std::make_shared<entities::Entity>();
+        auto entity = entities::create();
 
         entity->addComponent(std::make_unique<components::Camera>(center, range));
 
         return entity;
     }
 
+    // --------------------------------------------------------------
+    //
+    // For the one-off sprites (e.g., highlights) that aren't in the color
+    // table, the color is read straight from the configuration.
+    //
+    // --------------------------------------------------------------
     std::unique_ptr<components::AnimatedSprite> createAnimatedSprite(std::string keyLevel, std::string keyDOM, std::string keyContent)
     {
-        using namespace config;
+        const config::config_path SPRITE_COLOR = { config::DOM_CONTENT, config::DOM_LEVELS, keyLevel, keyDOM, config::DOM_SPRITE_COLOR };
 
-        const config_path TEXTURE = { DOM_CONTENT, DOM_LEVELS, keyLevel, keyDOM, DOM_FILENAME_ANIMATED };
-        const config_path SPRITE_COUNT = { DOM_CONTENT, DOM_LEVELS, keyLevel, keyDOM, DOM_SPRITE_COUNT };
-        const config_path SPRITE_TIME = { DOM_CONTENT, DOM_LEVELS, keyLevel, keyDOM, DOM_SPRITE_TIME };
-        const config_path SPRITE_COLOR = { DOM_CONTENT, DOM_LEVELS, keyLevel, keyDOM, DOM_SPRITE_COLOR };
-
-        auto spriteCount = Configuration::get<std::uint8_t>(SPRITE_COUNT);
-        auto spriteTime = misc::msTous(Configuration::get<std::chrono::milliseconds>(SPRITE_TIME));
-        auto texture = Content::get<sf::Texture>(keyContent);
-        auto colors = misc::split(Configuration::get<std::string>(SPRITE_COLOR), ',');
-        sf::Color spriteColor(static_cast<uint8_t>(std::stoi(colors[0])), static_cast<uint8_t>(std::stoi(colors[1])), static_cast<uint8_t>(std::stoi(colors[2])));
-
-        auto sprite = std::make_unique<components::AnimatedSprite>(texture, spriteCount, spriteTime, spriteColor);
-        sprite->getSprite()->setScale(math::getViewScale({ static_cast<float>(sprite->getSpriteCount()), 1.0f }, sprite->getSprite()->getTexture()));
-
-        return sprite;
+        return createAnimatedSprite(keyLevel, keyDOM, keyContent, Configuration::get<sf::Color>(SPRITE_COLOR));
     }
 
     std::unique_ptr<components::StaticSprite> createStaticSprite(std::string keyLevel, std::string keyDOM, std::string keyContent)
@@ -91,20 +184,19 @@ namespace entities
         const config_path SPRITE_COLOR = { DOM_CONTENT, DOM_LEVELS, keyLevel, keyDOM, DOM_SPRITE_COLOR };
 
         auto texture = Content::get<sf::Texture>(keyContent);
-        auto colors = misc::split(Configuration::get<std::string>(SPRITE_COLOR), ',');
-        sf::Color spriteColor(static_cast<uint8_t>(std::stoi(colors[0])), static_cast<uint8_t>(std::stoi(colors[1])), static_cast<uint8_t>(std::stoi(colors[2])));
+        auto spriteColor = Configuration::get<sf::Color>(SPRITE_COLOR);
 
-        auto sprite = std::make_unique<components::StaticSprite>(texture, spriteColor);
-        sprite->getSprite()->setScale(math::getViewScale({ 1.0f, 1.0f }, sprite->getSprite()->getTexture()));
+        auto sprite = std::make_unique<components::StaticSprite>(texture, Content::getTextureRect(keyContent), spriteColor);
+        sprite->getSprite()->setScale(math::getViewScale({ 1.0f, 1.0f }, sprite->getSprite()->getTextureRect()));
 
         return sprite;
     }
 
-    std::shared_ptr<Entity> createObject(misc::HexCoord position, components::ObjectType type, std::string word, std::string keyContent)
+    EntityPtr createObject(misc::HexCoord position, components::ObjectType type, std::string word, std::string keyContent)
     {
-        auto entity = std::make_shared<entities::Entity>();
+        auto entity = entities::create();
 
-        entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, word, keyContent));
+        entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, word, keyContent, getSpriteColor({ type })));
         entity->addComponent(std::make_unique<components::Position>(position));
         entity->addComponent(std::make_unique<components::Object>(type));
         entity->addComponent(std::make_unique<components::Property>(components::PropertyType::None));
@@ -121,9 +213,9 @@ namespace entities
     // --------------------------------------------------------------
     entities::EntityPtr createText(misc::HexCoord position, std::string word, components::TextType typeText, std::string keyContent)
     {
-        auto entity = std::make_shared<entities::Entity>();
+        auto entity = entities::create();
 
-        entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, word, keyContent));
+        entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, word, keyContent, getSpriteColor({ components::ObjectType::Text, typeText })));
         entity->addComponent(std::make_unique<components::Position>(position));
         entity->addComponent(std::make_unique<components::Object>(components::ObjectType::Text, typeText));
         entity->addComponent(std::make_unique<components::Property>(components::PropertyType::None));
@@ -179,7 +271,7 @@ namespace entities
 
     entities::EntityPtr createPhraseDirection(std::uint16_t id, misc::HexCoord position, misc::HexCoord::Direction direction, components::PhraseDirection::PhraseElement element)
     {
-        auto entity = std::make_shared<entities::Entity>();
+        auto entity = entities::create();
 
         entity->addComponent(std::make_unique<components::PhraseDirection>(id, position, direction, element));
 
@@ -209,80 +301,80 @@ namespace entities
         {
             case components::NounType::Word:
             {
-                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "text-word"s, content::KEY_TEXT_ANIMATED_WORD));
+                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "text-word"s, content::KEY_TEXT_ANIMATED_WORD, getSpriteColor({ components::ObjectType::Text, components::TextType::Text_Word })));
                 entity->addComponent(std::make_unique<components::Object>(components::ObjectType::Text, components::TextType::Text_Word));
                 entity->addComponent(std::make_unique<components::Noun>(components::NounType::Word));
             }
             break;
             case components::NounType::Wall:
             {
-                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "wall"s, content::KEY_IMAGE_ANIMATED_ENTITY_WALL));
+                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "wall"s, content::KEY_IMAGE_ANIMATED_ENTITY_WALL, getSpriteColor({ components::ObjectType::Wall })));
                 entity->addComponent(std::make_unique<components::Object>(components::ObjectType::Wall));
             }
             break;
             case components::NounType::Floor: // In theory, shouldn't happen
             {
-                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "floor"s, content::KEY_IMAGE_ANIMATED_ENTITY_FLOOR));
+                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "floor"s, content::KEY_IMAGE_ANIMATED_ENTITY_FLOOR, getSpriteColor({ components::ObjectType::Floor })));
                 entity->addComponent(std::make_unique<components::Object>(components::ObjectType::Floor));
             }
             break;
             case components::NounType::Flowers: // In theory, shouldn't happen
             {
-                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "flowers"s, content::KEY_IMAGE_ANIMATED_ENTITY_FLOWERS));
+                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "flowers"s, content::KEY_IMAGE_ANIMATED_ENTITY_FLOWERS, getSpriteColor({ components::ObjectType::Flowers })));
                 entity->addComponent(std::make_unique<components::Object>(components::ObjectType::Flowers));
             }
             break;
             case components::NounType::Grass: // In theory, shouldn't happen
             {
-                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "grass"s, content::KEY_IMAGE_ANIMATED_ENTITY_GRASS));
+                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "grass"s, content::KEY_IMAGE_ANIMATED_ENTITY_GRASS, getSpriteColor({ components::ObjectType::Grass })));
                 entity->addComponent(std::make_unique<components::Object>(components::ObjectType::Grass));
             }
             break;
             case components::NounType::Purple:
             {
-                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "purple"s, content::KEY_IMAGE_ANIMATED_ENTITY_PURPLE));
+                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "purple"s, content::KEY_IMAGE_ANIMATED_ENTITY_PURPLE, getSpriteColor({ components::ObjectType::Purple })));
                 entity->addComponent(std::make_unique<components::Object>(components::ObjectType::Purple));
             }
             break;
             case components::NounType::Grey:
             {
-                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "grey"s, content::KEY_IMAGE_ANIMATED_ENTITY_GREY));
+                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "grey"s, content::KEY_IMAGE_ANIMATED_ENTITY_GREY, getSpriteColor({ components::ObjectType::Grey })));
                 entity->addComponent(std::make_unique<components::Object>(components::ObjectType::Grey));
             }
             break;
             case components::NounType::Green:
             {
-                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "green"s, content::KEY_IMAGE_ANIMATED_ENTITY_GREEN));
+                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "green"s, content::KEY_IMAGE_ANIMATED_ENTITY_GREEN, getSpriteColor({ components::ObjectType::Green })));
                 entity->addComponent(std::make_unique<components::Object>(components::ObjectType::Green));
             }
             break;
             case components::NounType::Blue:
             {
-                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "blue"s, content::KEY_IMAGE_ANIMATED_ENTITY_BLUE));
+                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "blue"s, content::KEY_IMAGE_ANIMATED_ENTITY_BLUE, getSpriteColor({ components::ObjectType::Blue })));
                 entity->addComponent(std::make_unique<components::Object>(components::ObjectType::Blue));
             }
             break;
             case components::NounType::Red:
             {
-                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "red"s, content::KEY_IMAGE_ANIMATED_ENTITY_RED));
+                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "red"s, content::KEY_IMAGE_ANIMATED_ENTITY_RED, getSpriteColor({ components::ObjectType::Red })));
                 entity->addComponent(std::make_unique<components::Object>(components::ObjectType::Red));
             }
             break;
             case components::NounType::Brown:
             {
-                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "brown"s, content::KEY_IMAGE_ANIMATED_ENTITY_BROWN));
+                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "brown"s, content::KEY_IMAGE_ANIMATED_ENTITY_BROWN, getSpriteColor({ components::ObjectType::Brown })));
                 entity->addComponent(std::make_unique<components::Object>(components::ObjectType::Brown));
             }
             break;
             case components::NounType::Yellow:
             {
-                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "yellow"s, content::KEY_IMAGE_ANIMATED_ENTITY_YELLOW));
+                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "yellow"s, content::KEY_IMAGE_ANIMATED_ENTITY_YELLOW, getSpriteColor({ components::ObjectType::Yellow })));
                 entity->addComponent(std::make_unique<components::Object>(components::ObjectType::Yellow));
             }
             break;
             case components::NounType::Black:
             {
-                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "black"s, content::KEY_IMAGE_ANIMATED_ENTITY_BLACK));
+                entity->addComponent(createAnimatedSprite(config::DOM_IMAGES_OBJECTS, "black"s, content::KEY_IMAGE_ANIMATED_ENTITY_BLACK, getSpriteColor({ components::ObjectType::Black })));
                 entity->addComponent(std::make_unique<components::Object>(components::ObjectType::Black));
             }
             break;
@@ -305,6 +397,8 @@ namespace entities
     EntityFactoryCommandMap buildCodeToEntityCommandMap()
     {
         using namespace std::string_literals;
+        getSpriteColors(); // resolve the sprite colors before any entity needs one
+
         std::unordered_map<entities::EntityCode, std::function<entities::EntityPtr(misc::HexCoord position)>> map;
         //
         // Object types
@@ -132,11 +132,11 @@ namespace entities
         { components::ObjectType::Text, EntityCode::Text_Word }
     };
 
-    std::shared_ptr<Entity> createEntity(misc::HexCoord position, std::function<void(entities::EntityPtr)> apply);
-    std::shared_ptr<Entity> createCamera(misc::HexCoord center, std::uint8_t range);
+    EntityPtr createEntity(misc::HexCoord position, std::function<void(entities::EntityPtr)> apply);
+    EntityPtr createCamera(misc::HexCoord center, std::uint8_t range);
 
     std::unique_ptr<components::AnimatedSprite> createAnimatedSprite(std::string keyLevel, std::string keyDOM, std::string keyContent);
-    std::shared_ptr<Entity> createObject(misc::HexCoord position, components::ObjectType type, std::string word, std::string keyContent);
+    EntityPtr createObject(misc::HexCoord position, components::ObjectType type, std::string word, std::string keyContent);
     entities::EntityPtr createText(misc::HexCoord position, std::string word, components::TextType typeText, components::NounType typeNoun, std::string keyContent);
     entities::EntityPtr createText(misc::HexCoord position, std::string word, components::TextType typeText, components::VerbType typeVerb, std::string keyContent);
     entities::EntityPtr createPhraseDirection(std::uint16_t id, misc::HexCoord position, misc::HexCoord::Direction direction, components::PhraseDirection::PhraseElement element);
@@ -32,6 +32,7 @@ THE SOFTWARE.
 #include "services/MouseInput.hpp"
 #include "services/Scoring.hpp"
 #include "services/ThreadPool.hpp"
+#include "services/concurrency/Coroutine.hpp"
 #include "views/About.hpp"
 #include "views/Credits.hpp"
 #include "views/Gameplay.hpp"
@@ -54,7 +55,6 @@ THE SOFTWARE.
 #include <chrono>
 #include <fstream>
 #include <iostream>
-#include <latch>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -221,17 +221,10 @@ auto createUIViews()
 bool loadMenuContent()
 {
     std::atomic_bool success{ true };
-    std::latch contentDone{ 1 };
 
-    // IMPORTANT NOTE:  The last bit of content loaded below MUST invoke this on success, and none of the others
-    auto onComplete = [&]([[maybe_unused]] std::string key)
-    {
-        contentDone.count_down();
-    };
     auto onError = [&]([[maybe_unused]] std::string filename)
     {
         success = false;
-        contentDone.count_down();
     };
 
     //
@@ -266,14 +259,12 @@ bool loadMenuContent()
     // Get the challenge checkmark textures loaded
     Content::load<sf::Texture>(content::KEY_IMAGE_SCORING_CHECKMARK_EMPTY, Configuration::get<std::string>(config::IMAGE_SCORING_CHECKMARK_EMPTY), nullptr, onError);
     Content::load<sf::Texture>(content::KEY_IMAGE_SCORING_CHECKMARK_FILLED, Configuration::get<std::string>(config::IMAGE_SCORING_CHECKMARK_FILLED), nullptr, onError);
-    // NOTE: The last item in the function must include the call to onComplete!!
-    //       Why don't I have each one increment a count and have all call onComplete?  Because it is possible, but extremely unlikely, that all loading tasks
-    //       complete before the remainder of the content loading tasks are added.
-    Content::load<sf::Texture>(content::KEY_IMAGE_SCORING_CHECKMARK_BC_FILLED, Configuration::get<std::string>(config::IMAGE_SCORING_CHECKMARK_BC_FILLED), onComplete, onError);
+    Content::load<sf::Texture>(content::KEY_IMAGE_SCORING_CHECKMARK_BC_FILLED, Configuration::get<std::string>(config::IMAGE_SCORING_CHECKMARK_BC_FILLED), nullptr, onError);
 
     //
-    // Use an efficient wait for the initial content to finish loading
-    contentDone.wait();
+    // Use an efficient wait for the initial content to finish loading, the textures
+    // are uploaded by this thread while it waits.
+    Content::instance().waitUntilLoaded();
 
     return success;
 }
@@ -633,10 +624,20 @@ int main()
         exit(0);
     }
 
+    //
+    // The thread pool has to be configured before anything gets it going
+    ThreadPool::configure({ Configuration::get<std::uint16_t>(config::THREAD_POOL_WORKERS),
+                            Configuration::get<std::uint16_t>(config::THREAD_POOL_RESERVED_CORES),
+                            Configuration::get<bool>(config::THREAD_POOL_PIN_THREADS) });
+
     //
     // The Audio singleton needs to be specifically initialized
     Audio::instance().initialize();
 
+    //
+    // Only now that the audio threads exist, so they don't inherit the main thread's reserved cores
+    ThreadPool::pinMainThread();
+
     if (!loadMenuContent())
     {
         exit(0);
@@ -693,6 +694,15 @@ int main()
         exit(0);
     }
 
+    //
+    // The simulation steps forward in fixed increments, independent of how often
+    // the display is refreshed.  The accumulator holds the real time that hasn't yet
+    // been simulated, it is capped so that a long stall (e.g., dragging the window)
+    // doesn't turn into a burst of catch-up updates.
+    const std::chrono::microseconds UPDATE_STEP{ 1'000'000 / std::max(1, Configuration::get<int>(config::SIMULATION_UPDATE_RATE)) };
+    const std::chrono::microseconds MAX_ACCUMULATED{ 250'000 };
+    std::chrono::microseconds accumulator{ 0 };
+
     //
     // Grab an initial time-stamp to get the elapsed time working
     auto previousTime = std::chrono::system_clock::now();
@@ -716,16 +726,26 @@ int main()
         //
         // Execute the standard game loop steps
 
-        // Step 1: Process Input
-        KeyboardInput::instance().update(elapsedTime);
-        MouseInput::instance().update(elapsedTime);
-        ControllerInput::instance().update(elapsedTime);
+        // Get any textures that finished decoding in the background onto the GPU
+        Content::instance().processUploads();
+        // Resume anything that was waiting for the main thread
+        coro::processMain();
 
-        // Step 2: Update
-        auto nextViewState = view->update(elapsedTime, currentTime);
+        // Steps 1 & 2: Process Input & Update, as many fixed steps as have accumulated
+        accumulator = std::min(accumulator + elapsedTime, MAX_ACCUMULATED);
+        auto nextViewState = viewState;
+        while (accumulator >= UPDATE_STEP && nextViewState == viewState)
+        {
+            KeyboardInput::instance().update(UPDATE_STEP);
+            MouseInput::instance().update(UPDATE_STEP);
+            ControllerInput::instance().update(UPDATE_STEP);
+
+            nextViewState = view->update(UPDATE_STEP, currentTime);
+            accumulator -= UPDATE_STEP;
+        }
 
-        // Step 3: Render
-        view->render(*window, elapsedTime);
+        // Step 3: Render, given how far the display is ahead of the simulation
+        view->render(*window, accumulator);
 
         //
         // BUT, we still wait until here to display the window...this is what actually
@@ -0,0 +1,184 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace misc
+{
+    // --------------------------------------------------------------
+    //
+    // A simple, dynamically sized, set of bits.  The std::bitset has to
+    // know its size at compile time and std::vector<bool> doesn't
+    // expose its words, so neither allow whole-word operations (XOR,
+    // iterate only the set bits) this is used for.
+    //
+    // --------------------------------------------------------------
+    class Bitset
+    {
+      public:
+        using WordType = std::uint64_t;
+        static constexpr std::size_t BITS_PER_WORD = sizeof(WordType) * 8;
+
+        Bitset() = default;
+        Bitset(std::size_t size) { resize(size); }
+
+        std::size_t size() const { return m_size; }
+        void resize(std::size_t size)
+        {
+            m_words.resize((size + BITS_PER_WORD - 1) / BITS_PER_WORD, 0);
+            // Any bits beyond the new size have to be cleared, otherwise a later grow would bring them back
+            if (size < m_size && size % BITS_PER_WORD != 0)
+            {
+                m_words.back() &= (WordType{ 1 } << (size % BITS_PER_WORD)) - 1;
+            }
+            m_size = size;
+        }
+
+        bool test(std::size_t bit) const { return (m_words[bit / BITS_PER_WORD] >> (bit % BITS_PER_WORD)) & 1; }
+        void set(std::size_t bit) { m_words[bit / BITS_PER_WORD] |= (WordType{ 1 } << (bit % BITS_PER_WORD)); }
+        void reset(std::size_t bit) { m_words[bit / BITS_PER_WORD] &= ~(WordType{ 1 } << (bit % BITS_PER_WORD)); }
+        void reset()
+        {
+            for (auto&& word : m_words)
+            {
+                word = 0;
+            }
+        }
+
+        bool any() const
+        {
+            for (auto&& word : m_words)
+            {
+                if (word != 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::size_t count() const
+        {
+            std::size_t total{ 0 };
+            for (auto&& word : m_words)
+            {
+                total += std::popcount(word);
+            }
+            return total;
+        }
+
+        // Calls the function with the index of each set bit, in increasing order
+        template <typename F>
+        void forEach(F&& function) const
+        {
+            for (std::size_t index = 0; index < m_words.size(); index++)
+            {
+                auto word = m_words[index];
+                while (word != 0)
+                {
+                    function(index * BITS_PER_WORD + std::countr_zero(word));
+                    word &= word - 1; // clear the lowest set bit
+                }
+            }
+        }
+
+        // Calls the function with the index of each set bit in [first, last), in increasing order
+        template <typename F>
+        void forEach(std::size_t first, std::size_t last, F&& function) const
+        {
+            if (first >= last)
+            {
+                return;
+            }
+            auto firstWord = first / BITS_PER_WORD;
+            auto lastWord = (last - 1) / BITS_PER_WORD;
+            for (auto index = firstWord; index <= lastWord; index++)
+            {
+                auto word = m_words[index];
+                if (index == firstWord)
+                {
+                    word &= ~WordType{ 0 } << (first % BITS_PER_WORD);
+                }
+                if (index == lastWord && last % BITS_PER_WORD != 0)
+                {
+                    word &= (WordType{ 1 } << (last % BITS_PER_WORD)) - 1;
+                }
+                while (word != 0)
+                {
+                    function(index * BITS_PER_WORD + std::countr_zero(word));
+                    word &= word - 1;
+                }
+            }
+        }
+
+        // Both sides are expected to be the same size, the smaller one is treated as zero-filled
+        Bitset& operator^=(const Bitset& rhs)
+        {
+            if (rhs.m_size > m_size)
+            {
+                resize(rhs.m_size);
+            }
+            for (std::size_t index = 0; index < rhs.m_words.size(); index++)
+            {
+                m_words[index] ^= rhs.m_words[index];
+            }
+            return *this;
+        }
+
+        Bitset& operator|=(const Bitset& rhs)
+        {
+            if (rhs.m_size > m_size)
+            {
+                resize(rhs.m_size);
+            }
+            for (std::size_t index = 0; index < rhs.m_words.size(); index++)
+            {
+                m_words[index] |= rhs.m_words[index];
+            }
+            return *this;
+        }
+
+        Bitset& operator&=(const Bitset& rhs)
+        {
+            for (std::size_t index = 0; index < m_words.size(); index++)
+            {
+                m_words[index] &= index < rhs.m_words.size() ? rhs.m_words[index] : 0;
+            }
+            return *this;
+        }
+
+        friend Bitset operator^(Bitset lhs, const Bitset& rhs) { return lhs ^= rhs; }
+        friend Bitset operator|(Bitset lhs, const Bitset& rhs) { return lhs |= rhs; }
+        friend Bitset operator&(Bitset lhs, const Bitset& rhs) { return lhs &= rhs; }
+
+        bool operator==(const Bitset& rhs) const { return m_size == rhs.m_size && m_words == rhs.m_words; }
+
+      private:
+        std::size_t m_size{ 0 };
+        std::vector<WordType> m_words;
+    };
+} // namespace misc
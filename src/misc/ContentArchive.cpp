@@ -0,0 +1,273 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "ContentArchive.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace misc
+{
+    static constexpr std::array<char, 4> ARCHIVE_MAGIC{ 'T', 'M', 'S', 'A' };
+    static constexpr std::uint32_t ARCHIVE_VERSION{ 1 };
+
+    template <typename T>
+    void writeValue(std::ofstream& out, T value)
+    {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    bool readValue(const std::byte* data, std::size_t size, std::size_t& offset, T& value)
+    {
+        if (sizeof(T) > size - offset)
+        {
+            return false;
+        }
+        std::memcpy(&value, data + offset, sizeof(T));
+        offset += sizeof(T);
+
+        return true;
+    }
+
+    ContentArchive::~ContentArchive()
+    {
+        close();
+    }
+
+    bool ContentArchive::pack(const std::filesystem::path& folder, const std::filesystem::path& archive)
+    {
+        return pack(std::vector<std::filesystem::path>{ folder }, archive);
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Walks the folders and writes every file found into a single archive,
+    // each named by its path relative to the folder it was found in.  The
+    // files are sorted by name so the same content always produces the
+    // same archive.
+    //
+    // --------------------------------------------------------------
+    bool ContentArchive::pack(const std::vector<std::filesystem::path>& folders, const std::filesystem::path& archive)
+    {
+        std::vector<std::pair<std::string, std::filesystem::path>> found;
+        for (auto&& folder : folders)
+        {
+            for (auto&& entry : std::filesystem::recursive_directory_iterator(folder))
+            {
+                if (entry.is_regular_file())
+                {
+                    found.push_back({ std::filesystem::relative(entry.path(), folder).generic_string(), entry.path() });
+                }
+            }
+        }
+        std::ranges::sort(found);
+
+        std::vector<std::filesystem::path> files;
+        std::vector<std::string> names;
+        std::vector<std::uint64_t> sizes;
+        std::uint64_t indexSize = ARCHIVE_MAGIC.size() + sizeof(std::uint32_t) * 2;
+        for (auto&& [name, file] : found)
+        {
+            files.push_back(file);
+            names.push_back(name);
+            sizes.push_back(std::filesystem::file_size(file));
+            indexSize += sizeof(std::uint16_t) + names.back().size() + sizeof(std::uint64_t) * 2;
+        }
+
+        std::ofstream out(archive, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            return false;
+        }
+
+        out.write(ARCHIVE_MAGIC.data(), ARCHIVE_MAGIC.size());
+        writeValue(out, ARCHIVE_VERSION);
+        writeValue(out, static_cast<std::uint32_t>(files.size()));
+        std::uint64_t offset = indexSize;
+        for (std::size_t i = 0; i < files.size(); i++)
+        {
+            writeValue(out, static_cast<std::uint16_t>(names[i].size()));
+            out.write(names[i].data(), names[i].size());
+            writeValue(out, offset);
+            writeValue(out, sizes[i]);
+            offset += sizes[i];
+        }
+
+        for (std::size_t i = 0; i < files.size(); i++)
+        {
+            // Streaming an empty file sets the failbit, so don't
+            if (sizes[i] > 0)
+            {
+                std::ifstream in(files[i], std::ios::binary);
+                out << in.rdbuf();
+            }
+        }
+
+        return out.good();
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Memory maps the archive and builds the index of the files it contains.
+    //
+    // --------------------------------------------------------------
+    bool ContentArchive::open(const std::filesystem::path& archive)
+    {
+        close();
+#if defined(_WIN32)
+        m_file = CreateFileW(archive.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE)
+        {
+            m_file = nullptr;
+            return false;
+        }
+        LARGE_INTEGER size;
+        GetFileSizeEx(m_file, &size);
+        m_size = static_cast<std::size_t>(size.QuadPart);
+        m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_mapping != nullptr)
+        {
+            m_data = static_cast<const std::byte*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        }
+#else
+        int fd = ::open(archive.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return false;
+        }
+        struct stat status;
+        if (fstat(fd, &status) == 0 && status.st_size > 0)
+        {
+            m_size = static_cast<std::size_t>(status.st_size);
+            void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            m_data = data != MAP_FAILED ? static_cast<const std::byte*>(data) : nullptr;
+        }
+        // The mapping remains valid after the file is closed
+        ::close(fd);
+#endif
+        if (m_data == nullptr || !readIndex())
+        {
+            close();
+            return false;
+        }
+
+        return true;
+    }
+
+    void ContentArchive::close()
+    {
+        m_index.clear();
+#if defined(_WIN32)
+        if (m_data != nullptr)
+        {
+            UnmapViewOfFile(m_data);
+        }
+        if (m_mapping != nullptr)
+        {
+            CloseHandle(m_mapping);
+        }
+        if (m_file != nullptr)
+        {
+            CloseHandle(m_file);
+        }
+        m_mapping = nullptr;
+        m_file = nullptr;
+#else
+        if (m_data != nullptr)
+        {
+            munmap(const_cast<std::byte*>(m_data), m_size);
+        }
+#endif
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    std::optional<std::span<const std::byte>> ContentArchive::find(const std::string& name) const
+    {
+        auto entry = m_index.find(name);
+        if (entry == m_index.end())
+        {
+            return std::nullopt;
+        }
+
+        return entry->second;
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Validates the header and every entry, an archive that is truncated
+    // or otherwise damaged is rejected as a whole.
+    //
+    // --------------------------------------------------------------
+    bool ContentArchive::readIndex()
+    {
+        std::size_t offset{ 0 };
+        std::array<char, 4> magic;
+        if (!readValue(m_data, m_size, offset, magic) || magic != ARCHIVE_MAGIC)
+        {
+            return false;
+        }
+        std::uint32_t version{ 0 };
+        std::uint32_t count{ 0 };
+        if (!readValue(m_data, m_size, offset, version) || version != ARCHIVE_VERSION || !readValue(m_data, m_size, offset, count))
+        {
+            return false;
+        }
+
+        for (std::uint32_t i = 0; i < count; i++)
+        {
+            std::uint16_t length{ 0 };
+            if (!readValue(m_data, m_size, offset, length) || length > m_size - offset)
+            {
+                return false;
+            }
+            std::string name(reinterpret_cast<const char*>(m_data + offset), length);
+            offset += length;
+
+            std::uint64_t start{ 0 };
+            std::uint64_t size{ 0 };
+            if (!readValue(m_data, m_size, offset, start) || !readValue(m_data, m_size, offset, size) || start > m_size || size > m_size - start)
+            {
+                return false;
+            }
+            m_index[name] = std::span<const std::byte>(m_data + start, static_cast<std::size_t>(size));
+        }
+
+        return true;
+    }
+} // namespace misc
@@ -0,0 +1,84 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace misc
+{
+    // --------------------------------------------------------------
+    //
+    // A single, read-only file that packs together all of the content
+    // files (images, audio, fonts, etc).  The archive is memory mapped
+    // and the files inside of it are handed out as spans directly into
+    // the mapping, no copies are made.
+    //
+    // The layout of the archive is...
+    //   char[4]  magic "TMSA"
+    //   uint32   version
+    //   uint32   entry count
+    //   entries: uint16 name length, char[] name, uint64 offset, uint64 size
+    //   file data
+    //
+    // Names are the path of the file relative to the content folder,
+    // using '/' as the separator, e.g., "images/hex-empty.png".
+    //
+    // --------------------------------------------------------------
+    class ContentArchive
+    {
+      public:
+        ContentArchive() = default;
+        ContentArchive(const ContentArchive&) = delete;
+        ContentArchive& operator=(const ContentArchive&) = delete;
+        ~ContentArchive();
+
+        static bool pack(const std::filesystem::path& folder, const std::filesystem::path& archive);
+        static bool pack(const std::vector<std::filesystem::path>& folders, const std::filesystem::path& archive);
+
+        bool open(const std::filesystem::path& archive);
+        void close();
+        bool isOpen() const { return m_data != nullptr; }
+
+        std::optional<std::span<const std::byte>> find(const std::string& name) const;
+        std::size_t size() const { return m_index.size(); }
+
+      private:
+        const std::byte* m_data{ nullptr };
+        std::size_t m_size{ 0 };
+#if defined(_WIN32)
+        void* m_file{ nullptr };
+        void* m_mapping{ nullptr };
+#endif
+        std::unordered_map<std::string, std::span<const std::byte>> m_index;
+
+        bool readIndex();
+    };
+} // namespace misc
@@ -0,0 +1,220 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "TextureAtlas.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
+namespace misc
+{
+    namespace
+    {
+        template <typename T>
+        void appendValue(std::vector<std::byte>& data, T value)
+        {
+            auto bytes = reinterpret_cast<const std::byte*>(&value);
+            data.insert(data.end(), bytes, bytes + sizeof(T));
+        }
+
+        template <typename T>
+        bool takeValue(std::span<const std::byte> data, std::size_t& offset, T& value)
+        {
+            if (sizeof(T) > data.size() - offset)
+            {
+                return false;
+            }
+            std::memcpy(&value, data.data() + offset, sizeof(T));
+            offset += sizeof(T);
+
+            return true;
+        }
+
+        bool fits(std::uint32_t start, std::uint32_t length, std::uint32_t size)
+        {
+            return start <= size && length <= size - start;
+        }
+    } // namespace
+
+    // --------------------------------------------------------------
+    //
+    // Shelf packing, tallest images first, so each shelf wastes as little
+    // height as possible.  Names break the ties, so the same content always
+    // produces the same layout.  An image too big for a page is left out,
+    // it is loaded as a texture of its own.
+    //
+    // --------------------------------------------------------------
+    TextureAtlas TextureAtlas::layout(std::vector<Image> images, std::uint32_t pageSize)
+    {
+        std::ranges::sort(images, [](const Image& a, const Image& b)
+                          {
+                              return std::tie(b.size.height, b.size.width, a.name) < std::tie(a.size.height, a.size.width, b.name);
+                          });
+
+        TextureAtlas atlas;
+        std::uint32_t x{ 0 };
+        std::uint32_t y{ 0 };
+        std::uint32_t shelfHeight{ 0 };
+        for (auto&& image : images)
+        {
+            auto [width, height] = image.size;
+            if (width == 0 || height == 0 || width > pageSize || height > pageSize)
+            {
+                continue;
+            }
+
+            if (atlas.m_pages.empty())
+            {
+                atlas.m_pages.push_back({ 0, 0 });
+            }
+            if (x > 0 && width > pageSize - x)
+            {
+                x = 0;
+                y += shelfHeight + PADDING;
+                shelfHeight = 0;
+            }
+            if (y > pageSize || height > pageSize - y)
+            {
+                atlas.m_pages.push_back({ 0, 0 });
+                x = 0;
+                y = 0;
+                shelfHeight = 0;
+            }
+
+            auto& page = atlas.m_pages.back();
+            atlas.m_placements[image.name] = { static_cast<std::uint16_t>(atlas.m_pages.size() - 1), { x, y, width, height } };
+            page.width = std::max(page.width, x + width);
+            page.height = std::max(page.height, y + height);
+
+            x += std::min(width + PADDING, pageSize - x);
+            shelfHeight = std::max(shelfHeight, height);
+        }
+
+        return atlas;
+    }
+
+    std::vector<std::byte> TextureAtlas::serialize() const
+    {
+        std::vector<std::byte> data;
+        appendValue(data, static_cast<std::uint32_t>(m_pages.size()));
+        for (auto&& page : m_pages)
+        {
+            appendValue(data, page.width);
+            appendValue(data, page.height);
+        }
+
+        // Sorted by name, so the same layout always produces the same index
+        std::vector<std::pair<std::string, Placement>> placements(m_placements.begin(), m_placements.end());
+        std::ranges::sort(placements, {}, &std::pair<std::string, Placement>::first);
+
+        appendValue(data, static_cast<std::uint32_t>(placements.size()));
+        for (auto&& [name, placement] : placements)
+        {
+            appendValue(data, static_cast<std::uint16_t>(name.size()));
+            auto bytes = reinterpret_cast<const std::byte*>(name.data());
+            data.insert(data.end(), bytes, bytes + name.size());
+            appendValue(data, placement.page);
+            appendValue(data, placement.rect.left);
+            appendValue(data, placement.rect.top);
+            appendValue(data, placement.rect.width);
+            appendValue(data, placement.rect.height);
+        }
+
+        return data;
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Every placement is checked to be inside of its page, an index that
+    // is truncated or otherwise damaged is rejected as a whole.
+    //
+    // --------------------------------------------------------------
+    bool TextureAtlas::deserialize(std::span<const std::byte> data)
+    {
+        m_pages.clear();
+        m_placements.clear();
+
+        std::size_t offset{ 0 };
+        std::uint32_t pageCount{ 0 };
+        if (!takeValue(data, offset, pageCount) || pageCount > data.size() / sizeof(Size))
+        {
+            return false;
+        }
+        for (std::uint32_t i = 0; i < pageCount; i++)
+        {
+            Size page{ 0, 0 };
+            if (!takeValue(data, offset, page.width) || !takeValue(data, offset, page.height))
+            {
+                m_pages.clear();
+                return false;
+            }
+            m_pages.push_back(page);
+        }
+
+        std::uint32_t count{ 0 };
+        bool valid = takeValue(data, offset, count);
+        for (std::uint32_t i = 0; valid && i < count; i++)
+        {
+            std::uint16_t length{ 0 };
+            valid = takeValue(data, offset, length) && length <= data.size() - offset;
+            if (!valid)
+            {
+                break;
+            }
+            std::string name(reinterpret_cast<const char*>(data.data() + offset), length);
+            offset += length;
+
+            Placement placement{};
+            valid = takeValue(data, offset, placement.page) &&
+                    takeValue(data, offset, placement.rect.left) &&
+                    takeValue(data, offset, placement.rect.top) &&
+                    takeValue(data, offset, placement.rect.width) &&
+                    takeValue(data, offset, placement.rect.height) &&
+                    placement.page < m_pages.size() &&
+                    fits(placement.rect.left, placement.rect.width, m_pages[placement.page].width) &&
+                    fits(placement.rect.top, placement.rect.height, m_pages[placement.page].height);
+            if (valid)
+            {
+                m_placements[name] = placement;
+            }
+        }
+
+        if (!valid)
+        {
+            m_pages.clear();
+            m_placements.clear();
+        }
+        return valid;
+    }
+
+    std::optional<TextureAtlas::Placement> TextureAtlas::find(const std::string& name) const
+    {
+        auto placement = m_placements.find(name);
+        if (placement == m_placements.end())
+        {
+            return std::nullopt;
+        }
+
+        return placement->second;
+    }
+} // namespace misc
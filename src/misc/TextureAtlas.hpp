@@ -0,0 +1,100 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace misc
+{
+    // --------------------------------------------------------------
+    //
+    // Where each sprite sheet sits on the atlas pages built by the
+    // content packer.  The layout is computed offline, from only the
+    // names and sizes of the images, and stored in the content archive
+    // next to the page images.
+    //
+    // The layout of the index is...
+    //   uint32   page count
+    //   pages:   uint32 width, uint32 height
+    //   uint32   entry count
+    //   entries: uint16 name length, char[] name, uint16 page, uint32 left, top, width, height
+    //
+    // Names are the image filenames, the same as used to load the textures,
+    // e.g., "text-stop-256.png".
+    //
+    // --------------------------------------------------------------
+    class TextureAtlas
+    {
+      public:
+        static constexpr std::uint32_t MAX_PAGE_SIZE{ 8192 };
+        static constexpr std::uint32_t PADDING{ 2 }; // Keeps texture filtering from bleeding between neighbors
+
+        struct Rect
+        {
+            std::uint32_t left;
+            std::uint32_t top;
+            std::uint32_t width;
+            std::uint32_t height;
+        };
+
+        struct Placement
+        {
+            std::uint16_t page;
+            Rect rect;
+        };
+
+        struct Size
+        {
+            std::uint32_t width;
+            std::uint32_t height;
+        };
+
+        struct Image
+        {
+            std::string name;
+            Size size;
+        };
+
+        static TextureAtlas layout(std::vector<Image> images, std::uint32_t pageSize = MAX_PAGE_SIZE);
+        static std::string indexName() { return "atlas/index"; }
+        static std::string pageName(std::uint16_t page) { return "atlas/page-" + std::to_string(page) + ".png"; }
+
+        std::vector<std::byte> serialize() const;
+        bool deserialize(std::span<const std::byte> data);
+
+        std::optional<Placement> find(const std::string& name) const;
+        const auto& getPages() const { return m_pages; }
+        const auto& getPlacements() const { return m_placements; }
+        bool empty() const { return m_placements.empty(); }
+
+      private:
+        std::vector<Size> m_pages;
+        std::unordered_map<std::string, Placement> m_placements;
+    };
+} // namespace misc
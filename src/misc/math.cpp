@@ -63,10 +63,16 @@ namespace math
     //
     // --------------------------------------------------------------
     sf::Vector2f getViewScale(const Dimension2f size, const sf::Texture* texture)
+    {
+        return getViewScale(size, sf::IntRect(0, 0, static_cast<int>(texture->getSize().x), static_cast<int>(texture->getSize().y)));
+    }
+
+    // The scale for the part of a texture in rect, e.g., an image on an atlas page
+    sf::Vector2f getViewScale(const Dimension2f size, const sf::IntRect& rect)
     {
         auto coords = Configuration::getGraphics().getViewCoordinates();
-        return { (size.width / coords.width) * (coords.width / texture->getSize().x),
-                 (size.height / coords.height) * (coords.height / texture->getSize().y) };
+        return { (size.width / coords.width) * (coords.width / rect.width),
+                 (size.height / coords.height) * (coords.height / rect.height) };
     }
 
     sf::Vector2f getViewScale(const float size, const sf::Texture* texture)
@@ -171,6 +171,7 @@ namespace math
     Vector2f reflect(Vector2f n, Vector2f l);
     bool collides(entities::Entity& a, entities::Entity& b);
     sf::Vector2f getViewScale(const Dimension2f size, const sf::Texture* texture);
+    sf::Vector2f getViewScale(const Dimension2f size, const sf::IntRect& rect);
     sf::Vector2f getViewScale(const float size, const sf::Texture* texture);
 
     auto lerp(auto x, auto x0, auto x1, auto y0, auto y1)
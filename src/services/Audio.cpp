@@ -28,6 +28,9 @@ THE SOFTWARE.
 #include "services/Content.hpp"
 #include "services/ContentKey.hpp"
 
+#include <algorithm>
+#include <optional>
+
 // -----------------------------------------------------------------
 //
 // Using the Meyer's Singleton technique...this is thread safe
@@ -47,14 +50,11 @@ Audio& Audio::instance()
 // --------------------------------------------------------------
 void Audio::initialize()
 {
+    // The voices must exist before the sound thread starts using them
+    m_voices.resize(VOICE_COUNT);
+
     m_threadSound = std::make_unique<std::thread>(&Audio::runAudio, this);
     m_threadMusic = std::make_unique<std::thread>(&Audio::runMusic, this);
-    //
-    // Create a queue of 100 sf::Sound object that we'll cycle through.
-    while (m_sounds.size() < 100)
-    {
-        m_sounds.enqueue(std::make_shared<sf::Sound>());
-    }
 }
 
 // --------------------------------------------------------------
@@ -66,22 +66,56 @@ void Audio::initialize()
 void Audio::terminate()
 {
     m_doneSounds = true;
-    m_doneMusic = true;
+    {
+        std::lock_guard<std::mutex> lock(m_mutexMusic);
+        m_doneMusic = true;
+    }
+    signalMusic();
 
-    m_eventSound.notify_one();
+    m_commandsPending.fetch_add(1);
+    m_commandsPending.notify_one();
     m_threadSound->join();
     m_threadMusic->join();
 }
 
 // --------------------------------------------------------------
 //
-// Public method to allow client code to initiate a sound.
+// Returns the id used to play the sound for a content key.  Client code
+// that plays a sound often should get the id once and hold onto it.
 //
 // --------------------------------------------------------------
-void Audio::play(const std::string& key, float volume)
+Audio::SoundId Audio::getSoundId(const std::string& key)
 {
-    instance().m_tasksSound.enqueue({ key, volume });
-    instance().m_eventSound.notify_one();
+    std::lock_guard<std::mutex> lock(instance().m_mutexSoundIds);
+
+    auto [id, inserted] = instance().m_soundIds.try_emplace(key, static_cast<SoundId>(instance().m_soundKeys.size()));
+    if (inserted)
+    {
+        instance().m_soundKeys.push_back(key);
+    }
+
+    return id->second;
+}
+
+// --------------------------------------------------------------
+//
+// Public method to allow client code to initiate a sound.  Safe to call from
+// any thread, it never blocks.  If too many sounds are requested before the
+// sound thread gets to them, the extras are dropped.
+//
+// --------------------------------------------------------------
+void Audio::play(SoundId id, float volume, Priority priority)
+{
+    if (instance().m_commands.enqueue({ id, volume, priority }))
+    {
+        instance().m_commandsPending.fetch_add(1, std::memory_order_release);
+        instance().m_commandsPending.notify_one();
+    }
+}
+
+void Audio::play(const std::string& key, float volume, Priority priority)
+{
+    play(getSoundId(key), volume, priority);
 }
 
 // --------------------------------------------------------------
@@ -93,77 +127,227 @@ void Audio::play(const std::string& key, float volume)
 void Audio::addMusic(const std::string& key)
 {
     instance().m_keysMusic.enqueue(key);
+    instance().signalMusic();
 }
 
 // --------------------------------------------------------------
 //
-// This is the worker thread for sounds.  It pulls tasks from the queue and
-// completes them.  If there are no tasks, it goes into an efficient
-// wait state until a new task is added.
+// This is the worker thread for sounds.  It takes everything requested
+// since it last ran, collapses identical sounds into one, and starts them.
+// If there is nothing to do, it goes into an efficient wait state until
+// a new sound is requested.
 //
 // --------------------------------------------------------------
 void Audio::runAudio()
 {
     while (!m_doneSounds)
     {
-        auto task = m_tasksSound.dequeue();
-        if (task.has_value())
+        m_commandsPending.wait(0, std::memory_order_acquire);
+        m_commandsPending.exchange(0, std::memory_order_acquire);
+
+        m_batch.clear();
+        while (auto command = m_commands.dequeue())
         {
-            auto sound = m_sounds.dequeue().value();
-            sound->setBuffer(*Content::get<sf::SoundBuffer>(task.value().key));
-            sound->setVolume(task.value().volume);
-            sound->play();
-            m_sounds.enqueue(sound);
+            auto same = std::find_if(m_batch.begin(), m_batch.end(),
+                                     [&command](const Command& other)
+                                     {
+                                         return other.id == command->id;
+                                     });
+            if (same != m_batch.end())
+            {
+                same->volume = std::max(same->volume, command->volume);
+                same->priority = std::max(same->priority, command->priority);
+            }
+            else
+            {
+                m_batch.push_back(command.value());
+            }
         }
-        else
+
+        auto now = std::chrono::steady_clock::now();
+        for (auto&& command : m_batch)
         {
-            std::unique_lock<std::mutex> lock(m_mutexSound);
-            m_eventSound.wait(lock);
+            if (command.id >= m_lastStarted.size())
+            {
+                m_lastStarted.resize(command.id + 1);
+            }
+            if (now - m_lastStarted[command.id] >= DUPLICATE_WINDOW)
+            {
+                m_lastStarted[command.id] = now;
+                startVoice(command);
+            }
         }
     }
 }
 
+// --------------------------------------------------------------
+//
+// Plays the sound on an idle voice.  If every voice is busy, the oldest
+// voice with the lowest priority is taken over, as long as it isn't more
+// important than the new sound, otherwise the new sound is dropped.
+//
+// --------------------------------------------------------------
+void Audio::startVoice(const Command& command)
+{
+    auto buffer = getBuffer(command.id);
+    if (buffer == nullptr)
+    {
+        return;
+    }
+
+    Voice* selected{ nullptr };
+    for (auto&& voice : m_voices)
+    {
+        if (voice.sound.getStatus() == sf::Sound::Stopped)
+        {
+            selected = &voice;
+            break;
+        }
+        if (voice.priority <= command.priority &&
+            (selected == nullptr || voice.priority < selected->priority || (voice.priority == selected->priority && voice.started < selected->started)))
+        {
+            selected = &voice;
+        }
+    }
+    if (selected == nullptr)
+    {
+        return;
+    }
+
+    selected->sound.stop();
+    selected->sound.setBuffer(*buffer);
+    selected->sound.setVolume(command.volume);
+    selected->sound.play();
+    selected->priority = command.priority;
+    selected->started = ++m_voicesStarted;
+}
+
+// --------------------------------------------------------------
+//
+// The sound buffer for an id is looked up in the content only the first
+// time it is played.  Until the content is loaded, nothing is returned.
+//
+// --------------------------------------------------------------
+std::shared_ptr<sf::SoundBuffer> Audio::getBuffer(SoundId id)
+{
+    if (id >= m_buffers.size())
+    {
+        m_buffers.resize(id + 1);
+    }
+    if (m_buffers[id] == nullptr)
+    {
+        std::string key;
+        {
+            std::lock_guard<std::mutex> lock(m_mutexSoundIds);
+            key = m_soundKeys[id];
+        }
+        if (Content::has<sf::SoundBuffer>(key))
+        {
+            m_buffers[id] = Content::get<sf::SoundBuffer>(key);
+        }
+    }
+
+    return m_buffers[id];
+}
+
 // --------------------------------------------------------------
 //
 // This is the worker thread for music.  It pulls items from the
 // queue of music keys.  As long as the player has requested background
-// music, it will play music, looping through the queue.  Because
-// SFML doesn't have an event that fires when a music file ends
-// this thread just sleeps and wakes up every X seconds to check
-// on things.
+// music, it will play music, looping through the queue.  SFML doesn't
+// have an event that fires when a music file ends, so the thread computes
+// how much of the current song remains and sleeps until then.  It is also
+// woken when a song is added, when the play background music setting
+// changes, or when shutting down.  Otherwise it sits idle.
 //
 // --------------------------------------------------------------
 void Audio::runMusic()
 {
+    // Songs that stop a little later than computed are checked again after this long
+    static constexpr auto MINIMUM_WAIT = std::chrono::milliseconds(10);
+
+    Configuration::Value<bool> playMusic{ config::PLAY_BACKGROUND_MUSIC };
+    auto subscription = Configuration::subscribe(config::PLAY_BACKGROUND_MUSIC,
+                                                 [this](const std::vector<std::string>&)
+                                                 {
+                                                     signalMusic();
+                                                 });
+
+    std::unique_lock<std::mutex> lock(m_mutexMusic);
     while (!m_doneMusic)
     {
-        if (Configuration::get<bool>(config::PLAY_BACKGROUND_MUSIC) && m_keysMusic.size() > 0)
+        std::optional<std::chrono::microseconds> remaining;
+        if (playMusic.get() && m_keysMusic.size() > 0)
         {
-            // First check is to see if anything is playing, if not, then get something player
-            // Second check, if something is playing, see if it is done or not and move
-            // to the next song if it isn't playing.
             if (m_currentMusic == nullptr || m_currentMusic->getStatus() == sf::Music::Stopped)
             {
-                // Yes, we remove whatever is at the front, and then immediately place it at the back
-                // of the queue so we keep looping through the whole group of songs.
-                auto key = m_keysMusic.dequeue();
-                m_keysMusic.enqueue(key.value());
-
-                m_currentMusic = Content::get<sf::Music>(key.value());
-                m_currentMusic->stop();
-                m_currentMusic->setVolume(15);
-                m_currentMusic->setLoop(false);
-                m_currentMusic->play();
+                startNextMusic();
             }
+            auto duration = m_currentMusic->getDuration().asMicroseconds() - m_currentMusic->getPlayingOffset().asMicroseconds();
+            remaining = std::max(std::chrono::microseconds(duration), std::chrono::duration_cast<std::chrono::microseconds>(MINIMUM_WAIT));
         }
-        else if (!Configuration::get<bool>(config::PLAY_BACKGROUND_MUSIC))
+        else if (!playMusic.get())
         {
-            if (instance().m_currentMusic != nullptr)
+            if (m_currentMusic != nullptr)
             {
-                instance().m_currentMusic->stop();
-                instance().m_currentMusic = nullptr;
+                m_currentMusic->stop();
+                m_currentMusic = nullptr;
             }
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+        auto changed = [this]()
+        {
+            return m_musicChanged || m_doneMusic;
+        };
+        if (remaining.has_value())
+        {
+            m_eventMusic.wait_for(lock, remaining.value(), changed);
+        }
+        else
+        {
+            m_eventMusic.wait(lock, changed);
+        }
+        m_musicChanged = false;
+    }
+    lock.unlock();
+
+    Configuration::unsubscribe(subscription);
+}
+
+// --------------------------------------------------------------
+//
+// Plays the song that was made ready the last time through, then gets the
+// song after it ready, so the switch from one song to the next is only a
+// call to play.
+//
+// Yes, we remove whatever is at the front, and then immediately place it at the back
+// of the queue so we keep looping through the whole group of songs.
+//
+// --------------------------------------------------------------
+void Audio::startNextMusic()
+{
+    auto nextMusic = [this]()
+    {
+        auto key = m_keysMusic.dequeue();
+        m_keysMusic.enqueue(key.value());
+
+        auto music = Content::get<sf::Music>(key.value());
+        music->stop(); // Rewinds it to the beginning
+        music->setVolume(15);
+        music->setLoop(false);
+        return music;
+    };
+
+    m_currentMusic = m_nextMusic != nullptr ? m_nextMusic : nextMusic();
+    m_currentMusic->play();
+    m_nextMusic = m_keysMusic.size() > 1 ? nextMusic() : nullptr;
+}
+
+void Audio::signalMusic()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutexMusic);
+        m_musicChanged = true;
     }
+    m_eventMusic.notify_one();
 }
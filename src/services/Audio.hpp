@@ -23,26 +23,36 @@ THE SOFTWARE.
 #pragma once
 
 #include "services/concurrency/ConcurrentQueue.hpp"
+#include "services/concurrency/RingBuffer.hpp"
 
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 // --------------------------------------------------------------
 //
-// This is used throughout the game to play sounds.  It creates
-// the sf::Sound object that are responsible for the individual
-// sounds.  Music is not handled by this class, because there
+// This is used throughout the game to play sounds.  It owns a fixed
+// pool of sf::Sound voices that the individual sounds are played on.
+// Music is not handled by this class, because there
 // aren't any serious issues related to playing music that need
 // something more complex like this.
 //
+// Sounds are requested by id, resolved once from the content key
+// through getSoundId, and handed to the sound thread through a
+// lock-free ring buffer, so requesting a sound from inside of the
+// game update never blocks.
+//
 // I struggled to come up with a good name for it.  I didn't want
 // to call it a "system", because there are other kinds of systems.
 // I also didn't want to call it a "manager", because it seems
@@ -55,6 +65,16 @@ THE SOFTWARE.
 class Audio
 {
   public:
+    using SoundId = std::uint16_t;
+
+    // When all voices are busy, a sound may take over a voice playing a sound of the same or lower priority
+    enum class Priority : std::uint8_t
+    {
+        Low,
+        Normal,
+        High
+    };
+
     Audio(const Audio&) = delete;
     Audio(Audio&&) = delete;
     Audio& operator=(const Audio&) = delete;
@@ -64,42 +84,64 @@ class Audio
     void initialize();
     void terminate();
 
-    static void play(const std::string& key, float volume = 100.0f);
+    static SoundId getSoundId(const std::string& key);
+    static void play(SoundId id, float volume = 100.0f, Priority priority = Priority::Normal);
+    static void play(const std::string& key, float volume = 100.0f, Priority priority = Priority::Normal);
     static void addMusic(const std::string& key);
 
   private:
     Audio() {}
 
-    class Task
+    static constexpr std::size_t VOICE_COUNT{ 32 };
+    static constexpr std::size_t COMMAND_CAPACITY{ 256 };
+    // The same sound requested again within this window (e.g., many burns in one update) is only played once
+    static constexpr std::chrono::milliseconds DUPLICATE_WINDOW{ 30 };
+
+    struct Command
     {
-      public:
-        Task(std::string key, float volume) :
-            key(key),
-            volume(volume)
-        {
-        }
-
-        std::string key;
+        SoundId id;
         float volume;
+        Priority priority;
     };
 
-    // Storing shared_ptr because if you copy sf::Sound it stops playing, need to keep
-    // the original sf::Sound object around all the time.  Could change it to unique_ptr
-    // with a bunch of std::move I suppose, to improve efficiency.
-    ConcurrentQueue<std::shared_ptr<sf::Sound>> m_sounds;
+    struct Voice
+    {
+        sf::Sound sound;
+        Priority priority{ Priority::Low };
+        std::uint64_t started{ 0 };
+    };
 
-    bool m_doneSounds{ false };
+    // Resolving a key to an id is the only time a lock is taken, and it only happens once per key
+    std::mutex m_mutexSoundIds;
+    std::unordered_map<std::string, SoundId> m_soundIds;
+    std::vector<std::string> m_soundKeys;
+
+    std::atomic_bool m_doneSounds{ false };
     std::unique_ptr<std::thread> m_threadSound;
-    ConcurrentQueue<Task> m_tasksSound;
-    std::condition_variable m_eventSound;
-    std::mutex m_mutexSound;
+    RingBuffer<Command, COMMAND_CAPACITY> m_commands;
+    std::atomic_uint32_t m_commandsPending{ 0 };
+
+    // Everything below is only touched by the sound thread
+    std::vector<Voice> m_voices;
+    std::uint64_t m_voicesStarted{ 0 };
+    std::vector<Command> m_batch;
+    std::vector<std::shared_ptr<sf::SoundBuffer>> m_buffers;                   // by SoundId
+    std::vector<std::chrono::steady_clock::time_point> m_lastStarted;          // by SoundId
 
     // Music related items
     bool m_doneMusic{ false };
+    bool m_musicChanged{ false };
     std::unique_ptr<std::thread> m_threadMusic;
+    std::condition_variable m_eventMusic;
+    std::mutex m_mutexMusic;
     ConcurrentQueue<std::string> m_keysMusic;
     std::shared_ptr<sf::Music> m_currentMusic{ nullptr };
+    std::shared_ptr<sf::Music> m_nextMusic{ nullptr };
 
     void runAudio();
+    void startVoice(const Command& command);
+    std::shared_ptr<sf::SoundBuffer> getBuffer(SoundId id);
     void runMusic();
+    void signalMusic();
+    void startNextMusic();
 };
@@ -90,6 +90,7 @@ bool Configuration::initialize(const std::string_view jsonSettings, const std::s
     // order to set this correctly.
     m_graphics.m_uiScaled = false;
     m_graphics.updateScale();
+    m_generation++;
 
     return validParse;
 }
@@ -111,6 +112,57 @@ void Configuration::reset()
     instance().m_graphics = Graphics{};
     instance().m_domFull = rapidjson::Document{};
     instance().m_domSettings = rapidjson::Document{};
+    instance().m_generation++;
+}
+
+// --------------------------------------------------------------
+//
+// Register a function to be invoked whenever the value at the specified
+// path is changed through set<>.  The returned id is used to unsubscribe.
+//
+// --------------------------------------------------------------
+std::uint32_t Configuration::subscribe(const std::vector<std::string>& path, NotifyChange onChange)
+{
+    std::lock_guard<std::mutex> lock(instance().m_mutexSubscriptions);
+
+    auto id = instance().m_nextSubscriptionId++;
+    instance().m_subscriptions[id] = { path, onChange };
+
+    return id;
+}
+
+void Configuration::unsubscribe(std::uint32_t id)
+{
+    std::lock_guard<std::mutex> lock(instance().m_mutexSubscriptions);
+    instance().m_subscriptions.erase(id);
+}
+
+// --------------------------------------------------------------
+//
+// Invalidates all cached Value<T> handles and notifies anyone who
+// subscribed to this path.  The subscribers are invoked outside of
+// the lock so they are free to read (or even set) the configuration.
+//
+// --------------------------------------------------------------
+void Configuration::changed(const std::vector<std::string>& path)
+{
+    m_generation++;
+
+    std::vector<NotifyChange> notify;
+    {
+        std::lock_guard<std::mutex> lock(m_mutexSubscriptions);
+        for (auto&& [id, subscription] : m_subscriptions)
+        {
+            if (subscription.path == path)
+            {
+                notify.push_back(subscription.onChange);
+            }
+        }
+    }
+    for (auto&& onChange : notify)
+    {
+        onChange(path);
+    }
 }
 
 // --------------------------------------------------------------
@@ -214,6 +266,8 @@ void Configuration::set(const std::vector<std::string>& path, std::string value)
     // changed values to persist.
     misc::findJSONValue(instance().m_domFull, path)->value.SetString(value.c_str(), static_cast<rapidjson::SizeType>(value.size()), instance().m_domFull.GetAllocator());
     misc::findJSONValue(instance().m_domSettings, path)->value.SetString(value.c_str(), static_cast<rapidjson::SizeType>(value.size()), instance().m_domSettings.GetAllocator());
+
+    instance().changed(path);
 }
 
 template <>
@@ -221,6 +275,8 @@ void Configuration::set(const std::vector<std::string>& path, std::uint16_t valu
 {
     misc::findJSONValue(instance().m_domFull, path)->value.SetUint(value);
     misc::findJSONValue(instance().m_domSettings, path)->value.SetUint(value);
+
+    instance().changed(path);
 }
 
 template <>
@@ -228,6 +284,8 @@ void Configuration::set(const std::vector<std::string>& path, std::uint8_t value
 {
     misc::findJSONValue(instance().m_domFull, path)->value.SetUint(value);
     misc::findJSONValue(instance().m_domSettings, path)->value.SetUint(value);
+
+    instance().changed(path);
 }
 
 template <>
@@ -235,6 +293,8 @@ void Configuration::set(const std::vector<std::string>& path, bool value)
 {
     misc::findJSONValue(instance().m_domFull, path)->value.SetBool(value);
     misc::findJSONValue(instance().m_domSettings, path)->value.SetBool(value);
+
+    instance().changed(path);
 }
 
 template <>
@@ -242,6 +302,8 @@ void Configuration::set(const std::vector<std::string>& path, float value)
 {
     misc::findJSONValue(instance().m_domFull, path)->value.SetDouble(value);
     misc::findJSONValue(instance().m_domSettings, path)->value.SetDouble(value);
+
+    instance().changed(path);
 }
 
 // --------------------------------------------------------------
@@ -24,8 +24,13 @@ THE SOFTWARE.
 
 #include "misc/math.hpp"
 
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
 #include <rapidjson/document.h>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // --------------------------------------------------------------
@@ -55,6 +60,44 @@ class Configuration
     template <typename T>
     static void set(const std::vector<std::string>& path, T value);
 
+    using NotifyChange = std::function<void(const std::vector<std::string>&)>;
+    static std::uint32_t subscribe(const std::vector<std::string>& path, NotifyChange onChange);
+    static void unsubscribe(std::uint32_t id);
+
+    //
+    // A typed handle to a single configuration path.  The path is resolved
+    // against the DOM (and parsed into T) the first time it is read, and again
+    // only after the configuration has changed, otherwise reading it is a load
+    // of the cached value.  A handle is intended to be owned by a single
+    // thread, typically as a member of the system that reads it.
+    template <typename T>
+    class Value
+    {
+      public:
+        Value(const std::vector<std::string>& path) :
+            m_path(path)
+        {
+        }
+
+        const T& get()
+        {
+            auto generation = instance().m_generation.load(std::memory_order_acquire);
+            if (generation != m_generation)
+            {
+                m_value = Configuration::get<T>(m_path);
+                m_generation = generation;
+            }
+            return m_value;
+        }
+
+        const T& operator*() { return get(); }
+
+      private:
+        std::vector<std::string> m_path;
+        T m_value{};
+        std::uint32_t m_generation{ 0 };
+    };
+
     //
     // Additional Graphics configuration settings
     //
@@ -110,4 +153,18 @@ class Configuration
     rapidjson::Document m_domSettings;
 
     Graphics m_graphics;
+
+    // Bumped every time the DOM changes, used by Value<T> to know when to re-resolve
+    std::atomic_uint32_t m_generation{ 1 };
+
+    struct Subscription
+    {
+        std::vector<std::string> path;
+        NotifyChange onChange;
+    };
+    std::mutex m_mutexSubscriptions;
+    std::uint32_t m_nextSubscriptionId{ 1 };
+    std::unordered_map<std::uint32_t, Subscription> m_subscriptions;
+
+    void changed(const std::vector<std::string>& path);
 };
@@ -60,6 +60,10 @@ namespace config
     static const config_path DEVELOPER_HEX_COORDS_RENDER = { DOM_DEVELOPER, DOM_HEX_COORDS, "render"s }; // true if to render the hex coords
     static const config_path DEVELOPER_HEX_COORDS_FONT_FILENAME = { DOM_DEVELOPER, DOM_HEX_COORDS, DOM_FONT, DOM_FILENAME };
     static const config_path DEVELOPER_HEX_COORDS_FONT_SIZE = { DOM_DEVELOPER, DOM_HEX_COORDS, DOM_FONT, DOM_SIZE };
+    static const auto DOM_REPLAY = "replay"s;
+    static const config_path DEVELOPER_REPLAY_RECORD = { DOM_DEVELOPER, DOM_REPLAY, "record"s };                 // true to record each level played to a replay file
+    static const config_path DEVELOPER_REPLAY_PLAYBACK = { DOM_DEVELOPER, DOM_REPLAY, "playback"s };             // replay file to play back when its level is started, empty for none
+    static const config_path DEVELOPER_REPLAY_PLAYBACK_SPEED = { DOM_DEVELOPER, DOM_REPLAY, "playback-speed"s }; // multiple of real time, 0 to play back as fast as possible
 
     // --------------------------------------------------------------
     //
@@ -69,6 +73,11 @@ namespace config
     static const auto DOM_CAMERA = "camera"s;
     static const config_path CAMERA_RANGE_MIN = { DOM_CAMERA, "min-range"s };
     static const config_path CAMERA_RANGE_MAX = { DOM_CAMERA, "max-range"s };
+    static const config_path SIMULATION_UPDATE_RATE = { "simulation"s, "update-rate"s }; // fixed simulation updates per second
+    static const auto DOM_THREAD_POOL = "thread-pool"s;
+    static const config_path THREAD_POOL_WORKERS = { DOM_THREAD_POOL, "workers"s };               // worker threads, 0 to size from the physical cores
+    static const config_path THREAD_POOL_RESERVED_CORES = { DOM_THREAD_POOL, "reserved-cores"s }; // physical cores kept for the main (render) thread
+    static const config_path THREAD_POOL_PIN_THREADS = { DOM_THREAD_POOL, "pin-threads"s };       // true to pin the workers and main thread to their cores
 
     // --------------------------------------------------------------
     //
@@ -25,6 +25,7 @@ THE SOFTWARE.
 #include "services/ThreadPool.hpp"
 #include "services/concurrency//Task.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
 
@@ -34,6 +35,7 @@ static const std::string CONTENT_IMAGE_PATH{ "images" };
 static const std::string CONTENT_AUDIO_PATH{ "audio" };
 static const std::string CONTENT_MUSIC_PATH{ "music" };
 static const std::string CONTENT_LEVELS_PATH{ "levels" };
+static const std::string CONTENT_ARCHIVE{ "assets.pack" };
 
 // -----------------------------------------------------------------
 //
@@ -46,6 +48,39 @@ Content& Content::instance()
     return instance;
 }
 
+// -----------------------------------------------------------------
+//
+// If the content has been packed into an archive (see tools/ContentPacker),
+// it is used, otherwise everything comes from the individual files.  The
+// sprite sheet atlas is only used when the GPU can hold all of its pages,
+// otherwise the sheets are loaded as textures of their own.
+//
+// -----------------------------------------------------------------
+Content::Content()
+{
+    if (m_archive.open(CONTENT_ARCHIVE))
+    {
+        std::cout << "using content archive: " << CONTENT_ARCHIVE << " (" << m_archive.size() << " files)" << std::endl;
+
+        auto index = m_archive.find(CONTENT_IMAGE_PATH + "/" + misc::TextureAtlas::indexName());
+        if (index && m_atlas.deserialize(*index))
+        {
+            auto maximum = sf::Texture::getMaximumSize();
+            if (std::ranges::all_of(m_atlas.getPages(), [maximum](auto& page)
+                                    {
+                                        return page.width <= maximum && page.height <= maximum;
+                                    }))
+            {
+                std::cout << "using texture atlas: " << m_atlas.getPlacements().size() << " images on " << m_atlas.getPages().size() << " pages" << std::endl;
+            }
+            else
+            {
+                m_atlas = {};
+            }
+        }
+    }
+}
+
 // -----------------------------------------------------------------
 //
 // Used to gracefully let go of all the acquired resources before shutdown
@@ -53,13 +88,28 @@ Content& Content::instance()
 // -----------------------------------------------------------------
 void Content::terminate()
 {
+    std::lock_guard<std::mutex> lock(m_mutexContent);
     m_fonts.clear();
     m_fontsByFile.clear();
     m_textures.clear();
     m_texturesByFile.clear();
+    m_textureRects.clear();
     m_audio.clear();
     m_music.clear();
     m_sound.clear();
+    // Only after everything is released, because the music streams directly from the archive
+    m_archive.close();
+}
+
+// -----------------------------------------------------------------
+//
+// Returns the contents of the file if it is in the content archive.  The span
+// points directly into the mapped archive and is valid until terminate.
+//
+// -----------------------------------------------------------------
+std::optional<std::span<const std::byte>> Content::fromArchive(const std::string& folder, const std::string& filename)
+{
+    return instance().m_archive.find(folder + "/" + filename);
 }
 
 // --------------------------------------------------------------
@@ -102,28 +152,36 @@ bool Content::loadImpl<sf::Font>(LoadParams& params)
     // just reuse it...this saves quite a bit of time for this particular application
     // because the same font is used over and over
     std::shared_ptr<sf::Font> font{ nullptr };
-    if (!instance().m_fontsByFile.contains(params.filename))
     {
-        font = std::make_shared<sf::Font>();
-        if (!font->loadFromFile(path.string()))
+        std::lock_guard<std::mutex> lock(instance().m_mutexContent);
+        if (instance().m_fontsByFile.contains(params.filename))
         {
-            return false;
+            font = instance().m_fontsByFile[params.filename];
         }
-        instance().m_fontsByFile[params.filename] = font;
     }
-    else
+    if (font == nullptr)
     {
-        font = instance().m_fontsByFile[params.filename];
+        font = std::make_shared<sf::Font>();
+        auto packed = fromArchive(CONTENT_FONT_PATH, params.filename);
+        if (!(packed ? font->loadFromMemory(packed->data(), packed->size()) : font->loadFromFile(path.string())))
+        {
+            return false;
+        }
     }
 
-    instance().m_fonts[params.key] = font;
+    // If another worker finished loading the same file in the meantime, use that one instead
+    std::lock_guard<std::mutex> lock(instance().m_mutexContent);
+    instance().m_fontsByFile.try_emplace(params.filename, font);
+    instance().m_fonts[params.key] = instance().m_fontsByFile[params.filename];
 
     return true;
 }
 
 // --------------------------------------------------------------
 //
-// Specialization on sf::Texture for loading textures (for adding to sprites for rendering)
+// Specialization on sf::Texture for decoding the image of a texture.  Only
+// the decode takes place here, the upload to the GPU is done by the render
+// thread in processUploads.
 //
 // --------------------------------------------------------------
 template <>
@@ -133,26 +191,15 @@ bool Content::loadImpl<sf::Texture>(LoadParams& params)
     path /= CONTENT_IMAGE_PATH;
     path /= params.filename;
 
-    // Check to see if this filename is already loaded by filename, and if so,
-    // just reuse it...this saves quite a bit of time for this particular application
-    // because there is a basic hex texture that is reused quite a bit
-    std::shared_ptr<sf::Texture> image{ nullptr };
-    if (!instance().m_texturesByFile.contains(params.filename))
+    auto image = std::make_shared<sf::Image>();
+    auto packed = fromArchive(CONTENT_IMAGE_PATH, params.filename);
+    if (!(packed ? image->loadFromMemory(packed->data(), packed->size()) : image->loadFromFile(path.string())))
     {
-        image = std::make_shared<sf::Texture>();
-        if (!image->loadFromFile(path.string()))
-        {
-            return false;
-        }
-        image->setSmooth(true);
-        instance().m_texturesByFile[params.filename] = image;
-    }
-    else
-    {
-        image = instance().m_texturesByFile[params.filename];
+        return false;
     }
 
-    instance().m_textures[params.key] = image;
+    instance().m_uploads.enqueue({ params.filename, image });
+    instance().signalLoaded();
 
     return true;
 }
@@ -170,11 +217,13 @@ bool Content::loadImpl<sf::SoundBuffer>(LoadParams& params)
     path /= params.filename;
 
     auto audio = std::make_shared<sf::SoundBuffer>();
-    if (!audio->loadFromFile(path.string()))
+    auto packed = fromArchive(CONTENT_AUDIO_PATH, params.filename);
+    if (!(packed ? audio->loadFromMemory(packed->data(), packed->size()) : audio->loadFromFile(path.string())))
     {
         return false;
     }
 
+    std::lock_guard<std::mutex> lock(instance().m_mutexContent);
     instance().m_audio[params.key] = audio;
     // Create the matching sf::Sound that can be used to directly play the sound if desired
     instance().m_sound[params.key] = std::make_shared<sf::Sound>();
@@ -196,11 +245,13 @@ bool Content::loadImpl<sf::Music>(LoadParams& params)
     path /= params.filename;
 
     auto audio = std::make_shared<sf::Music>();
-    if (!audio->openFromFile(path.string()))
+    auto packed = fromArchive(CONTENT_MUSIC_PATH, params.filename);
+    if (!(packed ? audio->openFromMemory(packed->data(), packed->size()) : audio->openFromFile(path.string())))
     {
         return false;
     }
 
+    std::lock_guard<std::mutex> lock(instance().m_mutexContent);
     instance().m_music[params.key] = audio;
 
     return true;
@@ -208,27 +259,65 @@ bool Content::loadImpl<sf::Music>(LoadParams& params)
 
 // --------------------------------------------------------------
 //
-// Specialization on Levels for loading the game levels
+// Loading is spread across all of the general workers, rather than
+// going through the single IO thread, because nearly all of the time
+// is spent decoding the files, not waiting on the disk.  Each file is
+// its own background task, so loading never holds up a frame.
+//
+// --------------------------------------------------------------
+template <typename T>
+void Content::enqueueLoad(LoadParams params)
+{
+    Content::instance().m_tasksRemaining++;
+    coro::start(loadAsync<T>(std::move(params)));
+}
+
+template <typename T>
+coro::Task<> Content::loadAsync(LoadParams params)
+{
+    co_await coro::scheduleOn(coro::Executor::Background);
+
+    bool success = loadImpl<T>(params);
+    Content::instance().loadComplete(success, params);
+}
+
+// --------------------------------------------------------------
+//
+// Textures are completed by processUploads, once the decoded image has
+// been uploaded on the main thread, so only a failed decode completes
+// here, along with every key waiting on the same file.  The task count
+// is kept by load<sf::Texture>, one for each waiting key.
 //
 // --------------------------------------------------------------
 template <>
-void Content::load<Levels>(std::string key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError)
+coro::Task<> Content::loadAsync<sf::Texture>(LoadParams params)
 {
-    auto work = [=]()
+    co_await coro::scheduleOn(coro::Executor::Background);
+
+    if (!loadImpl<sf::Texture>(params))
     {
-        auto params = LoadParams{
-            key,
-            filename,
-            onComplete,
-            onError
-        };
-        bool success = loadImpl<Levels>(params);
-        Content::instance().loadComplete(success, params);
-    };
+        std::vector<LoadParams> waiting;
+        {
+            std::lock_guard<std::mutex> lock(instance().m_mutexContent);
+            waiting = std::move(instance().m_texturesWaiting[params.filename]);
+            instance().m_texturesWaiting.erase(params.filename);
+        }
+        for (auto&& item : waiting)
+        {
+            Content::instance().loadComplete(false, item);
+        }
+    }
+}
 
-    Content::instance().m_tasksRemaining++;
-    auto task = ThreadPool::instance().createIOTask(work);
-    ThreadPool::instance().enqueueTask(task);
+// --------------------------------------------------------------
+//
+// Specialization on Levels for loading the game levels
+//
+// --------------------------------------------------------------
+template <>
+void Content::load<Levels>(std::string key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError)
+{
+    enqueueLoad<Levels>({ key, filename, onComplete, onError });
 }
 
 // --------------------------------------------------------------
@@ -239,46 +328,61 @@ void Content::load<Levels>(std::string key, std::string filename, std::function<
 template <>
 void Content::load<sf::Font>(std::string key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError)
 {
-    auto work = [=]()
-    {
-        auto params = LoadParams{
-            key,
-            filename,
-            onComplete,
-            onError
-        };
-        bool success = loadImpl<sf::Font>(params);
-        Content::instance().loadComplete(success, params);
-    };
-
-    Content::instance().m_tasksRemaining++;
-    auto task = ThreadPool::instance().createIOTask(work);
-    ThreadPool::instance().enqueueTask(task);
+    enqueueLoad<sf::Font>({ key, filename, onComplete, onError });
 }
 
 // --------------------------------------------------------------
 //
 // Specialization on sf::Texture for loading textures (for adding to sprites for rendering)
 //
+// The same file is used by several keys (e.g., the basic hex texture), so
+// only the first request for a file decodes it, the others wait on it
+// and are completed when the texture has been uploaded.  An image packed
+// into the atlas is loaded as its atlas page, which all of the sprite
+// sheets on that page share.
+//
 // --------------------------------------------------------------
 template <>
 void Content::load<sf::Texture>(std::string key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError)
 {
-    auto work = [=]()
+    if (auto placement = instance().m_atlas.find(filename))
     {
-        auto params = LoadParams{
-            key,
-            filename,
-            onComplete,
-            onError
-        };
-        bool success = loadImpl<sf::Texture>(params);
-        Content::instance().loadComplete(success, params);
-    };
+        std::lock_guard<std::mutex> lock(instance().m_mutexContent);
+        auto [left, top, width, height] = placement->rect;
+        instance().m_textureRects[key] = sf::IntRect(static_cast<int>(left), static_cast<int>(top), static_cast<int>(width), static_cast<int>(height));
+        filename = misc::TextureAtlas::pageName(placement->page);
+    }
+    auto params = LoadParams{ key, filename, onComplete, onError };
 
-    Content::instance().m_tasksRemaining++;
-    auto task = ThreadPool::instance().createIOTask(work);
-    ThreadPool::instance().enqueueTask(task);
+    bool alreadyLoaded{ false };
+    {
+        std::lock_guard<std::mutex> lock(instance().m_mutexContent);
+        if (instance().m_texturesByFile.contains(filename))
+        {
+            instance().m_textures[key] = instance().m_texturesByFile[filename];
+            alreadyLoaded = true;
+        }
+        else
+        {
+            instance().m_tasksRemaining++;
+            auto& waiting = instance().m_texturesWaiting[filename];
+            waiting.push_back(params);
+            if (waiting.size() > 1)
+            {
+                return;
+            }
+        }
+    }
+    if (alreadyLoaded)
+    {
+        if (onComplete != nullptr)
+        {
+            onComplete(key);
+        }
+        return;
+    }
+
+    coro::start(loadAsync<sf::Texture>(std::move(params)));
 }
 
 // --------------------------------------------------------------
@@ -289,21 +393,7 @@ void Content::load<sf::Texture>(std::string key, std::string filename, std::func
 template <>
 void Content::load<sf::SoundBuffer>(std::string key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError)
 {
-    auto work = [=]()
-    {
-        auto params = LoadParams{
-            key,
-            filename,
-            onComplete,
-            onError
-        };
-        bool success = loadImpl<sf::SoundBuffer>(params);
-        Content::instance().loadComplete(success, params);
-    };
-
-    Content::instance().m_tasksRemaining++;
-    auto task = ThreadPool::instance().createIOTask(work);
-    ThreadPool::instance().enqueueTask(task);
+    enqueueLoad<sf::SoundBuffer>({ key, filename, onComplete, onError });
 }
 
 // --------------------------------------------------------------
@@ -314,21 +404,7 @@ void Content::load<sf::SoundBuffer>(std::string key, std::string filename, std::
 template <>
 void Content::load<sf::Music>(std::string key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError)
 {
-    auto work = [=]()
-    {
-        auto params = LoadParams{
-            key,
-            filename,
-            onComplete,
-            onError
-        };
-        bool success = loadImpl<sf::Music>(params);
-        Content::instance().loadComplete(success, params);
-    };
-
-    Content::instance().m_tasksRemaining++;
-    auto task = ThreadPool::instance().createIOTask(work);
-    ThreadPool::instance().enqueueTask(task);
+    enqueueLoad<sf::Music>({ key, filename, onComplete, onError });
 }
 
 // --------------------------------------------------------------
@@ -339,12 +415,15 @@ void Content::load<sf::Music>(std::string key, std::string filename, std::functi
 template <>
 std::shared_ptr<sf::Font> Content::get(std::string key)
 {
-    return instance().m_fonts[key];
+    std::lock_guard<std::mutex> lock(instance().m_mutexContent);
+    auto font = instance().m_fonts.find(key);
+    return font != instance().m_fonts.end() ? font->second : nullptr;
 }
 
 template <>
 bool Content::has<sf::Font>(std::string key)
 {
+    std::lock_guard<std::mutex> lock(instance().m_mutexContent);
     return instance().m_fonts.find(key) != instance().m_fonts.end();
 }
 
@@ -356,15 +435,42 @@ bool Content::has<sf::Font>(std::string key)
 template <>
 std::shared_ptr<sf::Texture> Content::get(std::string key)
 {
-    return instance().m_textures[key];
+    std::lock_guard<std::mutex> lock(instance().m_mutexContent);
+    auto texture = instance().m_textures.find(key);
+    return texture != instance().m_textures.end() ? texture->second : nullptr;
 }
 
 template <>
 bool Content::has<sf::Texture>(std::string key)
 {
+    std::lock_guard<std::mutex> lock(instance().m_mutexContent);
     return instance().m_textures.find(key) != instance().m_textures.end();
 }
 
+// --------------------------------------------------------------
+//
+// The part of the key's texture that is its image.  For an image on
+// an atlas page that is where it sits on the page, otherwise it is
+// the whole texture.
+//
+// --------------------------------------------------------------
+sf::IntRect Content::getTextureRect(std::string key)
+{
+    std::lock_guard<std::mutex> lock(instance().m_mutexContent);
+    if (auto rect = instance().m_textureRects.find(key); rect != instance().m_textureRects.end())
+    {
+        return rect->second;
+    }
+    auto texture = instance().m_textures.find(key);
+    if (texture == instance().m_textures.end())
+    {
+        return {};
+    }
+    auto size = texture->second->getSize();
+
+    return sf::IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y));
+}
+
 // --------------------------------------------------------------
 //
 // Specialization on sf::SoundBuffer for obtaining an audio clip
@@ -373,19 +479,24 @@ bool Content::has<sf::Texture>(std::string key)
 template <>
 std::shared_ptr<sf::SoundBuffer> Content::get(std::string key)
 {
-    return instance().m_audio[key];
+    std::lock_guard<std::mutex> lock(instance().m_mutexContent);
+    auto audio = instance().m_audio.find(key);
+    return audio != instance().m_audio.end() ? audio->second : nullptr;
 }
 
 template <>
 std::shared_ptr<sf::Sound> Content::get(std::string key)
 {
-    return instance().m_sound[key];
+    std::lock_guard<std::mutex> lock(instance().m_mutexContent);
+    auto sound = instance().m_sound.find(key);
+    return sound != instance().m_sound.end() ? sound->second : nullptr;
 }
 
 // Only need has<sf::SoundBuffer>, because it is good for both sf::Sound and sf::SoundBuffer
 template <>
 bool Content::has<sf::SoundBuffer>(std::string key)
 {
+    std::lock_guard<std::mutex> lock(instance().m_mutexContent);
     return instance().m_audio.find(key) != instance().m_audio.end();
 }
 
@@ -397,27 +508,95 @@ bool Content::has<sf::SoundBuffer>(std::string key)
 template <>
 std::shared_ptr<sf::Music> Content::get(std::string key)
 {
-    return instance().m_music[key];
+    std::lock_guard<std::mutex> lock(instance().m_mutexContent);
+    auto music = instance().m_music.find(key);
+    return music != instance().m_music.end() ? music->second : nullptr;
 }
 
 template <>
 bool Content::has<sf::Music>(std::string key)
 {
+    std::lock_guard<std::mutex> lock(instance().m_mutexContent);
     return instance().m_music.find(key) != instance().m_music.end();
 }
 
+// --------------------------------------------------------------
+//
+// Takes the images the workers have decoded and uploads them to
+// the GPU as textures.  This is called by the render thread every
+// frame, so any game content that finishes loading in the background
+// becomes available without anyone having to wait on it.
+//
+// --------------------------------------------------------------
+void Content::processUploads()
+{
+    while (auto upload = m_uploads.dequeue())
+    {
+        auto texture = std::make_shared<sf::Texture>();
+        bool success = texture->loadFromImage(*upload->image);
+        texture->setSmooth(true);
+
+        std::vector<LoadParams> waiting;
+        {
+            std::lock_guard<std::mutex> lock(m_mutexContent);
+            waiting = std::move(m_texturesWaiting[upload->filename]);
+            m_texturesWaiting.erase(upload->filename);
+            if (success)
+            {
+                m_texturesByFile[upload->filename] = texture;
+                for (auto&& params : waiting)
+                {
+                    m_textures[params.key] = texture;
+                }
+            }
+        }
+        for (auto&& params : waiting)
+        {
+            loadComplete(success, params);
+        }
+    }
+}
+
+// --------------------------------------------------------------
+//
+// Efficiently waits until all requested content has finished loading.  While
+// waiting, the textures the workers decode are uploaded by this (the render) thread.
+//
+// --------------------------------------------------------------
+void Content::waitUntilLoaded()
+{
+    while (true)
+    {
+        processUploads();
+
+        std::unique_lock<std::mutex> lock(m_mutexLoaded);
+        if (m_tasksRemaining == 0)
+        {
+            break;
+        }
+        if (m_uploads.sizeApprox() == 0)
+        {
+            m_eventLoaded.wait(lock);
+        }
+    }
+}
+
+void Content::signalLoaded()
+{
+    std::lock_guard<std::mutex> lock(m_mutexLoaded);
+    m_eventLoaded.notify_all();
+}
+
 void Content::loadComplete(bool success, LoadParams& params)
 {
     if (success)
     {
         std::cout << "finished loading: " << params.key << std::endl;
-        m_tasksRemaining--;
     }
     else
     {
         m_contentError = true;
         std::cout << "error in loading: " << params.filename << std::endl;
-        m_tasksRemaining--;
     }
     if (success && params.onComplete != nullptr)
     {
@@ -427,4 +606,7 @@ void Content::loadComplete(bool success, LoadParams& params)
     {
         params.onError(params.filename);
     }
+
+    m_tasksRemaining--;
+    signalLoaded();
 }
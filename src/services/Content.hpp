@@ -23,12 +23,17 @@ THE SOFTWARE.
 #pragma once
 
 #include "Levels.hpp"
+#include "misc/ContentArchive.hpp"
+#include "misc/TextureAtlas.hpp"
 #include "services/concurrency/ConcurrentQueue.hpp"
+#include "services/concurrency/Coroutine.hpp"
 
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <atomic>
 #include <condition_variable>
@@ -38,6 +43,7 @@ THE SOFTWARE.
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 // --------------------------------------------------------------
 //
@@ -68,6 +74,7 @@ class Content
     static std::shared_ptr<T> get(std::string key);
 
     static const Levels& getLevels() { return instance().m_levels; }
+    static sf::IntRect getTextureRect(std::string key);
 
     template <typename T>
     static bool has(std::string key);
@@ -75,8 +82,12 @@ class Content
     bool anyPending() { return m_tasksRemaining > 0; }
     bool isError() { return m_contentError; }
 
+    // Both of these must only be called from the rendering (main) thread
+    void processUploads();
+    void waitUntilLoaded();
+
   private:
-    Content() {}
+    Content();
 
     class LoadParams
     {
@@ -87,20 +98,43 @@ class Content
         std::function<void(std::string)> onError;
     };
 
+    // An image decoded by a worker, waiting for the render thread to upload it to the GPU
+    class PendingUpload
+    {
+      public:
+        std::string filename;
+        std::shared_ptr<sf::Image> image;
+    };
+
     Levels m_levels;
+    misc::ContentArchive m_archive; // When present, content is read from here rather than individual files
+    misc::TextureAtlas m_atlas;      // Where the sprite sheets are on the atlas pages, empty when there isn't an atlas
+    std::mutex m_mutexContent; // Protects all of the containers below, loading takes place across all workers
     std::unordered_map<std::string, std::shared_ptr<sf::Font>> m_fonts;
     std::unordered_map<std::string, std::shared_ptr<sf::Font>> m_fontsByFile;
     std::unordered_map<std::string, std::shared_ptr<sf::Texture>> m_textures;
     std::unordered_map<std::string, std::shared_ptr<sf::Texture>> m_texturesByFile;
+    std::unordered_map<std::string, std::vector<LoadParams>> m_texturesWaiting; // by filename, the keys waiting on a decode/upload
+    std::unordered_map<std::string, sf::IntRect> m_textureRects;                 // by key, where the key's image is on its atlas page
     std::unordered_map<std::string, std::shared_ptr<sf::SoundBuffer>> m_audio;
     std::unordered_map<std::string, std::shared_ptr<sf::Music>> m_music;
     std::unordered_map<std::string, std::shared_ptr<sf::Sound>> m_sound;
 
     std::atomic_bool m_contentError{ false };
     std::atomic_uint16_t m_tasksRemaining{ 0 };
+    ConcurrentQueue<PendingUpload> m_uploads;
+    std::condition_variable m_eventLoaded;
+    std::mutex m_mutexLoaded;
 
     template <typename T>
     static bool loadImpl(LoadParams& params);
 
+    template <typename T>
+    static void enqueueLoad(LoadParams params);
+    template <typename T>
+    static coro::Task<> loadAsync(LoadParams params);
+    static std::optional<std::span<const std::byte>> fromArchive(const std::string& folder, const std::string& filename);
+
     void loadComplete(bool success, LoadParams& task);
+    void signalLoaded();
 };
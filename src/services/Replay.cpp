@@ -0,0 +1,273 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Replay.hpp"
+
+#include "misc/HexCoord.hpp"
+#include "systems/Camera.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+
+static constexpr std::array<char, 4> REPLAY_MAGIC{ 'T', 'M', 'S', 'R' };
+static constexpr std::uint16_t REPLAY_VERSION{ 1 };
+static constexpr std::size_t REPLAY_MIN_FRAME_SIZE{ 2 }; // one byte of elapsed time and the event count
+
+// --------------------------------------------------------------
+//
+// The action and its value are cast straight to their enums when played
+// back, so anything out of range in the file must be caught on load.
+//
+// --------------------------------------------------------------
+static bool isValid(const Replay::Event& event)
+{
+    switch (event.action)
+    {
+        case Replay::Action::Move:
+        case Replay::Action::MoveWithPull:
+            return event.value <= static_cast<std::uint8_t>(misc::HexCoord::Direction::SE);
+        case Replay::Action::Undo:
+        case Replay::Action::Reset:
+            return true;
+        case Replay::Action::Camera:
+            return event.value <= static_cast<std::uint8_t>(systems::Camera::Input::ZoomOut);
+    }
+
+    return false;
+}
+
+// -----------------------------------------------------------------
+//
+// Using the Meyer's Singleton technique...this is thread safe
+//
+// -----------------------------------------------------------------
+Replay& Replay::instance()
+{
+    static Replay instance;
+    return instance;
+}
+
+void Replay::startRecording(const std::string& levelUUID)
+{
+    std::lock_guard<std::mutex> lock(m_mutexRecord);
+
+    m_levelUUID = levelUUID;
+    m_frames.clear();
+    m_recording = true;
+}
+
+bool Replay::stopRecording(const std::filesystem::path& filename)
+{
+    std::lock_guard<std::mutex> lock(m_mutexRecord);
+
+    m_recording = false;
+    return save(filename);
+}
+
+// --------------------------------------------------------------
+//
+// Every update of the game model is a frame, whether or not anything
+// happens during it, so the timing of the session is preserved.
+//
+// --------------------------------------------------------------
+void Replay::beginFrame(std::chrono::microseconds elapsedTime)
+{
+    if (m_recording)
+    {
+        std::lock_guard<std::mutex> lock(m_mutexRecord);
+        m_frames.push_back({ elapsedTime, {} });
+    }
+}
+
+void Replay::record(Action action, std::uint8_t value)
+{
+    if (m_recording)
+    {
+        std::lock_guard<std::mutex> lock(m_mutexRecord);
+        if (!m_frames.empty())
+        {
+            m_frames.back().events.push_back({ action, value });
+        }
+    }
+}
+
+bool Replay::startPlayback(const std::filesystem::path& filename)
+{
+    m_playing = load(filename);
+    m_nextFrame = 0;
+
+    return m_playing;
+}
+
+void Replay::stopPlayback()
+{
+    m_playing = false;
+    m_frames.clear();
+}
+
+std::optional<Replay::Frame> Replay::nextFrame()
+{
+    if (!m_playing || m_nextFrame >= m_frames.size())
+    {
+        return std::nullopt;
+    }
+
+    return m_frames[m_nextFrame++];
+}
+
+// --------------------------------------------------------------
+//
+// The elapsed time is written as a variable length integer, 7 bits at
+// a time, because it is nearly always small; most frames take 3 bytes.
+//
+// --------------------------------------------------------------
+bool Replay::save(const std::filesystem::path& filename)
+{
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        std::cout << "failed to save replay: " << filename << std::endl;
+        return false;
+    }
+
+    auto write = [&out](auto value)
+    {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    out.write(REPLAY_MAGIC.data(), REPLAY_MAGIC.size());
+    write(REPLAY_VERSION);
+    write(static_cast<std::uint16_t>(m_levelUUID.size()));
+    out.write(m_levelUUID.data(), m_levelUUID.size());
+    write(static_cast<std::uint32_t>(m_frames.size()));
+    for (auto&& frame : m_frames)
+    {
+        auto elapsed = static_cast<std::uint64_t>(std::max(frame.elapsedTime.count(), static_cast<std::chrono::microseconds::rep>(0)));
+        do
+        {
+            auto byte = static_cast<std::uint8_t>(elapsed & 0x7f);
+            elapsed >>= 7;
+            write(static_cast<std::uint8_t>(elapsed > 0 ? byte | 0x80 : byte));
+        } while (elapsed > 0);
+
+        // A frame never has anywhere near this many events, but just in case
+        auto events = std::min(frame.events.size(), static_cast<std::size_t>(UINT8_MAX));
+        write(static_cast<std::uint8_t>(events));
+        for (std::size_t i = 0; i < events; i++)
+        {
+            write(frame.events[i].action);
+            write(frame.events[i].value);
+        }
+    }
+
+    return out.good();
+}
+
+// --------------------------------------------------------------
+//
+// Nothing in the file is trusted, the frame count is checked against
+// what is left of the file before anything is allocated for it, and
+// every event is checked before it can be played back.
+//
+// --------------------------------------------------------------
+bool Replay::load(const std::filesystem::path& filename)
+{
+    // A replay is either loaded completely or not at all, whatever was
+    // read before finding the file is bad is thrown away
+    auto reject = [this]()
+    {
+        m_levelUUID.clear();
+        m_frames.clear();
+        return false;
+    };
+
+    std::error_code error;
+    auto fileSize = std::filesystem::file_size(filename, error);
+    if (error)
+    {
+        return reject();
+    }
+
+    std::ifstream in(filename, std::ios::binary);
+    auto read = [&in](auto& value)
+    {
+        in.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return in.good();
+    };
+
+    std::array<char, 4> magic;
+    std::uint16_t version{ 0 };
+    std::uint16_t length{ 0 };
+    if (!read(magic) || magic != REPLAY_MAGIC || !read(version) || version != REPLAY_VERSION || !read(length))
+    {
+        std::cout << "not a valid replay: " << filename << std::endl;
+        return reject();
+    }
+    m_levelUUID.resize(length);
+    if (!in.read(m_levelUUID.data(), length))
+    {
+        return reject();
+    }
+
+    std::uint32_t count{ 0 };
+    if (!read(count) || count > (fileSize - static_cast<std::uintmax_t>(in.tellg())) / REPLAY_MIN_FRAME_SIZE)
+    {
+        return reject();
+    }
+    m_frames.resize(count);
+    for (auto&& frame : m_frames)
+    {
+        std::uint64_t elapsed{ 0 };
+        std::uint8_t byte{ 0 };
+        int shift{ 0 };
+        do
+        {
+            if (!read(byte))
+            {
+                return reject();
+            }
+            elapsed |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            shift += 7;
+        } while ((byte & 0x80) && shift < 64);
+        frame.elapsedTime = std::chrono::microseconds(elapsed);
+
+        std::uint8_t events{ 0 };
+        if (!read(events))
+        {
+            return reject();
+        }
+        frame.events.resize(events);
+        for (auto&& event : frame.events)
+        {
+            if (!read(event.action) || !read(event.value) || !isValid(event))
+            {
+                return reject();
+            }
+        }
+    }
+
+    return true;
+}
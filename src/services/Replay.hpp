@@ -0,0 +1,112 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+// --------------------------------------------------------------
+//
+// Records the game actions taken while playing a level, and plays
+// them back.  What is recorded is the resolved action (e.g., move
+// north-west with a pull), not the key or button that caused it,
+// along with the elapsed time of every update.  Because of this, a
+// replay doesn't depend on the input bindings, and it can be played
+// back faster than real time.
+//
+// The file format is...
+//   char[4]  magic "TMSR"
+//   uint16   version
+//   uint16   level uuid length, char[] level uuid
+//   uint32   frame count
+//   frames:  varint elapsed microseconds, uint8 event count, events: uint8 action, uint8 value
+//
+// Note: This is a Singleton
+//
+// --------------------------------------------------------------
+class Replay
+{
+  public:
+    enum class Action : std::uint8_t
+    {
+        Move,         // value is the misc::HexCoord::Direction
+        MoveWithPull, // value is the misc::HexCoord::Direction
+        Undo,
+        Reset,
+        Camera // value is the systems::Camera::Input
+    };
+
+    struct Event
+    {
+        Action action;
+        std::uint8_t value{ 0 };
+
+        bool operator==(const Event&) const = default;
+    };
+
+    struct Frame
+    {
+        std::chrono::microseconds elapsedTime{ 0 };
+        std::vector<Event> events;
+    };
+
+    Replay(const Replay&) = delete;
+    Replay(Replay&&) = delete;
+    Replay& operator=(const Replay&) = delete;
+    Replay& operator=(Replay&&) = delete;
+
+    static Replay& instance();
+
+    void startRecording(const std::string& levelUUID);
+    bool stopRecording(const std::filesystem::path& filename);
+    bool isRecording() { return m_recording; }
+    void beginFrame(std::chrono::microseconds elapsedTime);
+    void record(Action action, std::uint8_t value = 0);
+
+    bool startPlayback(const std::filesystem::path& filename);
+    void stopPlayback();
+    bool isPlaying() { return m_playing; }
+    std::optional<Frame> nextFrame();
+
+    const std::string& getLevelUUID() { return m_levelUUID; }
+
+  private:
+    Replay() {}
+
+    std::atomic_bool m_recording{ false };
+    std::atomic_bool m_playing{ false };
+    std::mutex m_mutexRecord; // Actions are recorded by systems running on different workers
+    std::string m_levelUUID;
+    std::vector<Frame> m_frames;
+    std::size_t m_nextFrame{ 0 };
+
+    bool save(const std::filesystem::path& filename);
+    bool load(const std::filesystem::path& filename);
+};
@@ -27,8 +27,6 @@ THE SOFTWARE.
 #include "entities/Factory.hpp"
 #include "misc/misc.hpp"
 #include "services/Content.hpp"
-#include "services/ThreadPool.hpp"
-#include "services/concurrency/Task.hpp"
 
 #include <algorithm>
 #include <filesystem>
@@ -108,10 +106,16 @@ bool Scoring::hasAnyScore()
 
 // --------------------------------------------------------------
 //
-// Update which challenges have been met.
+// Update which challenges have been met.  The update and saving of
+// the scores file takes place on the IO thread.
 //
 // --------------------------------------------------------------
 void Scoring::recordScore(std::shared_ptr<Level> level, const ChallengeGroup& score, std::function<void()> onComplete)
+{
+    coro::start(recordScoreAsync(level, score, onComplete));
+}
+
+coro::Task<> Scoring::recordScoreAsync(std::shared_ptr<Level> level, ChallengeGroup score, std::function<void()> onComplete)
 {
     // This is used to compare challenges so they can be ordered for
     // determining duplicates...so they can be removed.
@@ -141,35 +145,36 @@ void Scoring::recordScore(std::shared_ptr<Level> level, const ChallengeGroup& sc
         return false;
     };
 
-    auto work = [this, level, score]()
+    co_await coro::scheduleOn(coro::Executor::IO);
+
+    // Create/Get the level entry in the DOM
+    rapidjson::Value levelKey(rapidjson::kStringType);
+    levelKey.SetString(level->getUUID().c_str(), static_cast<rapidjson::SizeType>(level->getUUID().size()), m_domScores.GetAllocator());
+    if (!m_domScores.HasMember(level->getUUID().c_str()))
     {
-        // Create/Get the level entry in the DOM
-        rapidjson::Value levelKey(rapidjson::kStringType);
-        levelKey.SetString(level->getUUID().c_str(), static_cast<rapidjson::SizeType>(level->getUUID().size()), m_domScores.GetAllocator());
-        if (!m_domScores.HasMember(level->getUUID().c_str()))
-        {
-            m_domScores.AddMember(levelKey, rapidjson::Value(rapidjson::kStringType), m_domScores.GetAllocator());
-        }
-        auto levelData = m_domScores.FindMember(level->getUUID().c_str());
-        auto challenges = parseChallenges(levelData->value.GetString());
-        challenges.push_back(score);
+        m_domScores.AddMember(levelKey, rapidjson::Value(rapidjson::kStringType), m_domScores.GetAllocator());
+    }
+    auto levelData = m_domScores.FindMember(level->getUUID().c_str());
+    auto challenges = parseChallenges(levelData->value.GetString());
+    challenges.push_back(score);
 
-        // Remove duplicates
-        std::sort(challenges.begin(), challenges.end(), lessChallengeGroup);
-        auto last = std::unique(challenges.begin(), challenges.end());
-        challenges.erase(last, challenges.end());
+    // Remove duplicates
+    std::sort(challenges.begin(), challenges.end(), lessChallengeGroup);
+    auto last = std::unique(challenges.begin(), challenges.end());
+    challenges.erase(last, challenges.end());
 
-        auto formatted = formatChallengesJSON(challenges);
-        rapidjson::Value jsonScore(rapidjson::kStringType);
-        jsonScore.SetString(formatted.c_str(), static_cast<rapidjson::SizeType>(formatted.size()), m_domScores.GetAllocator());
-        levelData->value = jsonScore;
+    auto formatted = formatChallengesJSON(challenges);
+    rapidjson::Value jsonScore(rapidjson::kStringType);
+    jsonScore.SetString(formatted.c_str(), static_cast<rapidjson::SizeType>(formatted.size()), m_domScores.GetAllocator());
+    levelData->value = jsonScore;
 
-        // Finally, go ahead and update the configuration file right now
-        persist();
-    };
+    // Finally, go ahead and update the configuration file right now
+    persist();
 
-    auto task = ThreadPool::instance().createIOTask(work, onComplete);
-    ThreadPool::instance().enqueueTask(task);
+    if (onComplete)
+    {
+        onComplete();
+    }
 }
 
 // --------------------------------------------------------------
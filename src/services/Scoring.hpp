@@ -23,6 +23,7 @@ THE SOFTWARE.
 #pragma once
 
 #include "components/Object.hpp"
+#include "services/concurrency/Coroutine.hpp"
 
 #include <cstdint>
 #include <functional>
@@ -70,6 +71,7 @@ class Scoring
   private:
     Scoring() {}
 
+    coro::Task<> recordScoreAsync(std::shared_ptr<Level> level, ChallengeGroup score, std::function<void()> onComplete);
     std::string serialize();
     void persist();
     void cleanPreRelease();
@@ -22,6 +22,55 @@ THE SOFTWARE.
 
 #include "ThreadPool.hpp"
 
+#include <algorithm>
+
+ThreadPool::Settings ThreadPool::m_settings;
+
+// -----------------------------------------------------------------
+//
+// Records the settings the pool is created with.
+//
+// -----------------------------------------------------------------
+void ThreadPool::configure(const Settings& settings)
+{
+    m_settings = settings;
+}
+
+// -----------------------------------------------------------------
+//
+// When pinning, the calling thread, expected to be the main thread, is
+// pinned to the reserved cores, so the workers won't be competing with it.
+// A new thread inherits the affinity of the thread that creates it, so
+// this must be called after the main thread has created the audio
+// threads; the workers and the IO thread are created here, before pinning.
+//
+// -----------------------------------------------------------------
+void ThreadPool::pinMainThread()
+{
+    instance();
+    if (m_settings.pinThreads && m_settings.reservedCores > 0)
+    {
+        std::vector<std::uint32_t> processors;
+        for (std::size_t core = 0; core < std::min<std::size_t>(m_settings.reservedCores, topology().physicalCores() - 1); core++)
+        {
+            processors.insert(processors.end(), topology().core(core).begin(), topology().core(core).end());
+        }
+        CpuTopology::pinCurrentThread(processors);
+    }
+}
+
+// -----------------------------------------------------------------
+//
+// The topology doesn't change while running, it is only detected once
+//
+// -----------------------------------------------------------------
+const CpuTopology& ThreadPool::topology()
+{
+    static const CpuTopology topology = CpuTopology::detect();
+
+    return topology;
+}
+
 // -----------------------------------------------------------------
 //
 // Using the Meyer's Singleton technique...this is thread safe
@@ -29,7 +78,7 @@ THE SOFTWARE.
 // -----------------------------------------------------------------
 ThreadPool& ThreadPool::instance()
 {
-    static ThreadPool instance{ static_cast<uint16_t>(std::thread::hardware_concurrency()) };
+    static ThreadPool instance{ m_settings };
 
     return instance;
 }
@@ -67,18 +116,41 @@ void ThreadPool::terminate()
 // -----------------------------------------------------------------
 //
 // The constructor creates the worker threads the thread pool will use
-// to process tasks.
+// to process tasks.  Unless told otherwise, there is one worker per
+// physical core, less the cores reserved for the main thread; SMT
+// siblings and the audio and IO threads, which spend nearly all their
+// time blocked, aren't counted.  At least one core is always left for
+// the workers.
+//
+// Every worker drains the frame lane before looking at the background
+// lane, but a background task can't be interrupted once started.  So,
+// when there is more than one worker, the first one only ever takes
+// frame tasks, ensuring the frame never waits for a long background
+// task to finish.
 //
 // -----------------------------------------------------------------
-ThreadPool::ThreadPool(uint16_t sizeInitial)
+ThreadPool::ThreadPool(const Settings& settings)
 {
-    for (std::uint16_t thread = 0; thread < sizeInitial; thread++)
+    auto reserved = std::min<std::size_t>(settings.reservedCores, topology().physicalCores() - 1);
+    auto available = topology().physicalCores() - reserved;
+    auto workers = settings.workers > 0 ? settings.workers : available;
+
+    for (std::size_t thread = 0; thread < workers; thread++)
     {
-        auto worker = std::make_shared<WorkerThread>(m_workQueue, m_eventWorkQueue, m_mutexWorkQueueEvent);
+        std::vector<ConcurrentQueue<std::shared_ptr<Task>>*> lanes{ &m_frameQueue };
+        if (thread > 0 || workers == 1)
+        {
+            lanes.push_back(&m_backgroundQueue);
+        }
+        auto worker = std::make_shared<WorkerThread>(lanes, m_eventWorkQueue, m_mutexWorkQueueEvent);
+        if (settings.pinThreads)
+        {
+            worker->pin(topology().core(reserved + thread % available));
+        }
         m_threads.insert(worker);
     }
 
-    m_ioThread = std::make_shared<WorkerThread>(m_ioWorkQueue, m_ioEventWorkQueue, m_ioMutexWorkQueueEvent);
+    m_ioThread = std::make_shared<WorkerThread>(std::vector{ &m_ioWorkQueue }, m_ioEventWorkQueue, m_ioMutexWorkQueueEvent);
 }
 
 // -----------------------------------------------------------------
@@ -92,13 +164,19 @@ void ThreadPool::enqueueTask(std::shared_ptr<Task> source)
     m_activeTasks++;
     // Want to have the most common tasks be part of the 'true' path because that
     // should, "in theory" result in faster execution; but I haven't really tested it.
-    if (!source->isIO())
+    if (!source->isIO() && source->getPriority() == Task::Priority::Frame)
     {
 
-        m_workQueue.enqueue(source);
+        m_frameQueue.enqueue(source);
         // Notify a thread something was added to the queue, so it can be picked up and worked on
         m_eventWorkQueue.notify_one();
     }
+    else if (!source->isIO())
+    {
+        m_backgroundQueue.enqueue(source);
+        // All of them, because the one woken might be the worker that only takes frame tasks
+        m_eventWorkQueue.notify_all();
+    }
     else
     {
         m_ioWorkQueue.enqueue(source);
@@ -131,6 +209,18 @@ std::shared_ptr<Task> ThreadPool::createIOTask(std::function<void(void)> job, st
     return std::make_shared<Task>(0, true, job, onComplete);
 }
 
+// -----------------------------------------------------------------
+//
+// Background tasks are for work no frame is waiting on, such as loading
+// content.  Keep each one reasonably short, by splitting up long work
+// into several tasks, because once started it holds on to its worker.
+//
+// -----------------------------------------------------------------
+std::shared_ptr<Task> ThreadPool::createBackgroundTask(std::function<void(void)> job, std::function<void(void)> onComplete)
+{
+    return std::make_shared<Task>(0, false, job, onComplete, Task::Priority::Background);
+}
+
 std::shared_ptr<Task> ThreadPool::createTask(std::shared_ptr<ConcurrentTaskGraph>& graph, std::function<void(void)> job, std::function<void(void)> onComplete)
 {
     auto task = std::make_shared<Task>(graph->getId(), false, job, onComplete);
@@ -177,28 +267,140 @@ void ThreadPool::enqueueAvailableGraphTasks(std::shared_ptr<ConcurrentTaskGraph>
     }
 
     std::vector<std::shared_ptr<Task>> tasks;
+    std::vector<std::shared_ptr<Task>> tasksBackground;
     std::vector<std::shared_ptr<Task>> tasksIO;
     while (!graph->queueEmpty())
     {
         m_activeTasks++;
         auto task = graph->dequeue();
-        if (!task->isIO())
+        if (task->isIO())
         {
-            tasks.push_back(task);
+            tasksIO.push_back(task);
+        }
+        else if (task->getPriority() == Task::Priority::Background)
+        {
+            tasksBackground.push_back(task);
         }
         else
         {
-            tasksIO.push_back(task);
+            tasks.push_back(task);
         }
     }
 
-    m_workQueue.enqueue(tasks);
+    m_frameQueue.enqueue(tasks);
+    m_backgroundQueue.enqueue(tasksBackground);
     m_eventWorkQueue.notify_all();
 
     m_ioWorkQueue.enqueue(tasksIO);
     m_ioEventWorkQueue.notify_all();
 }
 
+// -----------------------------------------------------------------
+//
+// Runs the job for every index in [0, count) across the worker threads,
+// returning once all of them are done.  The calling thread claims indices
+// right along with the workers, so this can be used from inside of a task
+// without waiting on work no worker is free to pick up.  A helper task
+// that starts after all indices have been claimed has nothing to do.
+//
+// -----------------------------------------------------------------
+void ThreadPool::parallelFor(std::size_t count, std::function<void(std::size_t)> job)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    struct Shared
+    {
+        std::function<void(std::size_t)> job;
+        std::size_t count;
+        std::atomic_size_t next{ 0 };
+        std::atomic_size_t remaining{ 0 };
+    };
+    auto shared = std::make_shared<Shared>();
+    shared->job = std::move(job);
+    shared->count = count;
+    shared->remaining = count;
+
+    auto work = [shared]()
+    {
+        for (auto index = shared->next++; index < shared->count; index = shared->next++)
+        {
+            shared->job(index);
+            if (--shared->remaining == 0)
+            {
+                shared->remaining.notify_all();
+            }
+        }
+    };
+
+    auto helpers = std::min(count, m_threads.size() + 1) - 1;
+    for (std::size_t helper = 0; helper < helpers; helper++)
+    {
+        enqueueTask(createTask(work));
+    }
+    work();
+
+    // Whatever was claimed by the helpers might still be running
+    waitHelping(shared->remaining);
+}
+
+void ThreadPool::TaskGroup::run(std::function<void(void)> job)
+{
+    (*m_remaining)++;
+    ThreadPool::instance().enqueueTask(ThreadPool::instance().createTask(
+        [remaining = m_remaining, job = std::move(job)]()
+        {
+            job();
+            if (--*remaining == 0)
+            {
+                remaining->notify_all();
+            }
+        }));
+}
+
+void ThreadPool::TaskGroup::wait()
+{
+    ThreadPool::instance().waitHelping(*m_remaining);
+}
+
+// -----------------------------------------------------------------
+//
+// Takes the next frame task, if there is one, and runs it on the
+// calling thread, exactly as a worker would have.
+//
+// -----------------------------------------------------------------
+bool ThreadPool::runFrameTask()
+{
+    auto task = m_frameQueue.dequeue();
+    if (task)
+    {
+        task.value()->execute();
+        taskComplete(task.value());
+    }
+
+    return task.has_value();
+}
+
+// -----------------------------------------------------------------
+//
+// Waits for the count to reach zero, working on frame tasks in the
+// meantime.  Only sleeps when there is nothing queued, in which case
+// everything still being waited on is already running somewhere.
+//
+// -----------------------------------------------------------------
+void ThreadPool::waitHelping(const std::atomic_size_t& remaining)
+{
+    for (auto current = remaining.load(); current > 0; current = remaining.load())
+    {
+        if (!runFrameTask())
+        {
+            remaining.wait(current);
+        }
+    }
+}
+
 // -----------------------------------------------------------------
 //
 // When a task completes, need to update the graph it is associated with
@@ -23,11 +23,13 @@ THE SOFTWARE.
 #pragma once
 
 #include "services/concurrency/ConcurrentTaskGraph.hpp"
+#include "services/concurrency/CpuTopology.hpp"
 #include "services/concurrency/Task.hpp"
 #include "services/concurrency/WorkerThread.hpp"
 
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -49,6 +51,33 @@ class ThreadPool
     ThreadPool& operator=(const ThreadPool&) = delete;
     ThreadPool& operator=(ThreadPool&&) = delete;
 
+    //
+    // How the pool sizes and places its worker threads.  Must be configured
+    // before the first use of the pool, otherwise the defaults are used.
+    struct Settings
+    {
+        std::uint16_t workers{ 0 };       // 0 to size from the physical cores available
+        std::uint16_t reservedCores{ 1 }; // physical cores kept for the main (render) thread
+        bool pinThreads{ false };         // pin workers to their own cores, and the main thread (see pinMainThread) to the reserved ones
+    };
+
+    //
+    // Fork-join of any number of jobs, usable from inside of a running task.
+    // While waiting, the thread works on queued frame tasks (including the
+    // group's own jobs) rather than sleeping.  Must be waited on before the
+    // group goes away.
+    class TaskGroup
+    {
+      public:
+        void run(std::function<void(void)> job);
+        void wait();
+
+      private:
+        std::shared_ptr<std::atomic_size_t> m_remaining{ std::make_shared<std::atomic_size_t>(0) };
+    };
+
+    static void configure(const Settings& settings);
+    static void pinMainThread();
     static ThreadPool& instance();
     static void terminate();
 
@@ -58,20 +87,26 @@ class ThreadPool
     std::shared_ptr<ConcurrentTaskGraph> createTaskGraph(std::function<void(void)> onComplete = nullptr);
     std::shared_ptr<Task> createTask(std::function<void(void)> job, std::function<void(void)> onComplete = nullptr);
     std::shared_ptr<Task> createIOTask(std::function<void(void)> job, std::function<void(void)> onComplete = nullptr);
+    std::shared_ptr<Task> createBackgroundTask(std::function<void(void)> job, std::function<void(void)> onComplete = nullptr);
     std::shared_ptr<Task> createTask(std::shared_ptr<ConcurrentTaskGraph>& graph, std::function<void(void)> job, std::function<void(void)> onComplete = nullptr);
     std::shared_ptr<Task> createIOTask(std::shared_ptr<ConcurrentTaskGraph>& graph, std::function<void(void)> job, std::function<void(void)> onComplete = nullptr);
     void submitTaskGraph(std::shared_ptr<ConcurrentTaskGraph> graph);
+    void parallelFor(std::size_t count, std::function<void(std::size_t)> job);
 
   protected:
-    ThreadPool(uint16_t sizeInitial);
+    ThreadPool(const Settings& settings);
 
   private:
+    static Settings m_settings;
+    static const CpuTopology& topology();
     std::function<void(void)> m_onEmpty{ nullptr };
     std::atomic_uint32_t m_activeTasks{ 0 };
     std::mutex m_mutexTaskComplete;
 
     std::set<std::shared_ptr<WorkerThread>> m_threads;
-    ConcurrentQueue<std::shared_ptr<Task>> m_workQueue;
+    // Frame tasks have a lane of their own, so they never wait behind background work
+    ConcurrentQueue<std::shared_ptr<Task>> m_frameQueue;
+    ConcurrentQueue<std::shared_ptr<Task>> m_backgroundQueue;
     std::condition_variable m_eventWorkQueue;
     std::mutex m_mutexWorkQueueEvent;
     std::unordered_map<std::uint64_t, std::shared_ptr<ConcurrentTaskGraph>> m_taskGraphs;
@@ -83,6 +118,8 @@ class ThreadPool
     std::mutex m_ioMutexWorkQueueEvent;
 
     void enqueueAvailableGraphTasks(std::shared_ptr<ConcurrentTaskGraph> graph);
+    bool runFrameTask();
+    void waitHelping(const std::atomic_size_t& remaining);
     void taskComplete(const std::shared_ptr<Task>& task);
 
     friend class WorkerThread; // to allow it to call taskComplete
@@ -22,9 +22,14 @@ THE SOFTWARE.
 
 #pragma once
 
+#include "RingBuffer.hpp"
+
+#include <atomic>
+#include <cstddef>
 #include <deque>
 #include <mutex>
 #include <optional>
+#include <type_traits>
 #include <vector>
 
 // ------------------------------------------------------------------
@@ -32,8 +37,15 @@ THE SOFTWARE.
 // @details This is a fairly simple concurrent queue that allows thread
 // safe access.
 //
+// Items go through a lock-free RingBuffer of RingCapacity items, with a
+// deque behind a mutex holding only the items that didn't fit in the
+// ring.  Once anything has spilled into the deque, it is used until the
+// consumers have drained it, which keeps the items from each producer
+// in order.  A RingCapacity of 0 leaves out the ring, making it only a
+// deque behind a mutex.
+//
 // ------------------------------------------------------------------
-template <typename T>
+template <typename T, std::size_t RingCapacity = 1024>
 class ConcurrentQueue
 {
   public:
@@ -44,9 +56,21 @@ class ConcurrentQueue
     // ------------------------------------------------------------------
     void enqueue(const T& item)
     {
+        if constexpr (HAS_RING)
+        {
+            if (m_overflowSize.load(std::memory_order_acquire) == 0 && m_ring.enqueue(item))
+            {
+                return;
+            }
+        }
+
         std::lock_guard<std::mutex> lock(m_mutex);
 
         m_queue.push_back(item);
+        if constexpr (HAS_RING)
+        {
+            m_overflowSize.fetch_add(1, std::memory_order_release);
+        }
     }
 
     // ------------------------------------------------------------------
@@ -56,11 +80,29 @@ class ConcurrentQueue
     // ------------------------------------------------------------------
     void enqueue(const std::vector<T>& items)
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        std::size_t enqueued{ 0 };
+        if constexpr (HAS_RING)
+        {
+            while (enqueued < items.size() && m_overflowSize.load(std::memory_order_acquire) == 0)
+            {
+                auto count = m_ring.enqueueBulk(items.data() + enqueued, items.size() - enqueued);
+                if (count == 0)
+                {
+                    break;
+                }
+                enqueued += count;
+            }
+        }
 
-        for (auto&& item : items)
+        if (enqueued < items.size())
         {
-            m_queue.push_back(item);
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_queue.insert(m_queue.end(), items.begin() + enqueued, items.end());
+            if constexpr (HAS_RING)
+            {
+                m_overflowSize.fetch_add(items.size() - enqueued, std::memory_order_release);
+            }
         }
     }
 
@@ -73,21 +115,118 @@ class ConcurrentQueue
     // ------------------------------------------------------------------
     std::optional<T> dequeue()
     {
+        if constexpr (HAS_RING)
+        {
+            if (auto item = m_ring.dequeue())
+            {
+                return item;
+            }
+            if (m_overflowSize.load(std::memory_order_acquire) == 0)
+            {
+                return std::nullopt;
+            }
+        }
+
         std::lock_guard<std::mutex> lock(m_mutex);
 
         if (!m_queue.empty())
         {
-            auto item = m_queue.front();
+            auto item = std::move(m_queue.front());
             m_queue.pop_front();
+            if constexpr (HAS_RING)
+            {
+                m_overflowSize.fetch_sub(1, std::memory_order_release);
+            }
             return item;
         }
 
         return std::nullopt;
     }
 
-    std::size_t size() { return m_queue.size(); }
+    // ------------------------------------------------------------------
+    //
+    // Dequeues up to count items, handing each to onItem, returns how
+    // many were dequeued.  The ring is drained before the deque, the
+    // same as dequeue does one at a time.
+    //
+    // ------------------------------------------------------------------
+    template <typename OnItem>
+    std::size_t dequeueBulk(std::size_t count, OnItem&& onItem)
+    {
+        std::size_t dequeued{ 0 };
+        if constexpr (HAS_RING)
+        {
+            dequeued = m_ring.dequeueBulk(count, onItem);
+            if (dequeued == count || m_overflowSize.load(std::memory_order_acquire) == 0)
+            {
+                return dequeued;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        while (dequeued < count && !m_queue.empty())
+        {
+            onItem(std::move(m_queue.front()));
+            m_queue.pop_front();
+            dequeued++;
+            if constexpr (HAS_RING)
+            {
+                m_overflowSize.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        return dequeued;
+    }
+
+    std::size_t dequeueBulk(std::vector<T>& items, std::size_t count)
+    {
+        return dequeueBulk(count, [&items](T&& item)
+                           {
+                               items.push_back(std::move(item));
+                           });
+    }
+
+    // ------------------------------------------------------------------
+    //
+    // Doesn't take the lock, so while other threads are enqueuing or
+    // dequeuing it may be off by the items in flight.  Without the ring
+    // it is the same as size.
+    //
+    // ------------------------------------------------------------------
+    std::size_t sizeApprox() const
+    {
+        if constexpr (HAS_RING)
+        {
+            return m_ring.sizeApprox() + m_overflowSize.load(std::memory_order_acquire);
+        }
+        else
+        {
+            return size();
+        }
+    }
+
+    std::size_t size() const
+    {
+        std::size_t ringSize{ 0 };
+        if constexpr (HAS_RING)
+        {
+            ringSize = m_ring.sizeApprox();
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        return ringSize + m_queue.size();
+    }
 
   private:
+    static constexpr bool HAS_RING = RingCapacity > 0;
+    struct NoRing
+    {
+    };
+
+    [[no_unique_address]] std::conditional_t<HAS_RING, RingBuffer<T, RingCapacity>, NoRing> m_ring;
+    std::atomic<std::size_t> m_overflowSize{ 0 }; // Lets the ring skip the lock while nothing has spilled
     std::deque<T> m_queue;
-    std::mutex m_mutex;
+    mutable std::mutex m_mutex;
 };
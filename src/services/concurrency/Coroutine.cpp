@@ -0,0 +1,79 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Coroutine.hpp"
+
+#include "ConcurrentQueue.hpp"
+#include "services/ThreadPool.hpp"
+
+namespace coro
+{
+    namespace
+    {
+        // Using the Meyer's Singleton technique, for the coroutines waiting on the main thread
+        ConcurrentQueue<std::coroutine_handle<>>& mainQueue()
+        {
+            static ConcurrentQueue<std::coroutine_handle<>> queue;
+
+            return queue;
+        }
+    } // namespace
+
+    // -----------------------------------------------------------------
+    //
+    // The coroutine is resumed by a thread pool task, so it is tracked
+    // by the pool, and respects its lanes, just like any other task.
+    //
+    // -----------------------------------------------------------------
+    void ScheduleOn::await_suspend(std::coroutine_handle<> handle)
+    {
+        auto resume = [handle]()
+        {
+            handle.resume();
+        };
+
+        switch (m_executor)
+        {
+            case Executor::Frame:
+                ThreadPool::instance().enqueueTask(ThreadPool::instance().createTask(resume));
+                break;
+            case Executor::Background:
+                ThreadPool::instance().enqueueTask(ThreadPool::instance().createBackgroundTask(resume));
+                break;
+            case Executor::IO:
+                ThreadPool::instance().enqueueTask(ThreadPool::instance().createIOTask(resume));
+                break;
+            case Executor::Main:
+                mainQueue().enqueue(handle);
+                break;
+        }
+    }
+
+    void processMain()
+    {
+        while (auto handle = mainQueue().dequeue())
+        {
+            handle->resume();
+        }
+    }
+} // namespace coro
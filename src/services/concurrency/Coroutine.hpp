@@ -0,0 +1,438 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <latch>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// -----------------------------------------------------------------
+//
+// Coroutine support on top of the thread pool.  Work is written as a
+// coro::Task<T> coroutine, using co_await coro::scheduleOn(...) to
+// move itself onto the kind of thread it needs next, and co_await on
+// other tasks (or coro::whenAll of several) to wait on their results
+// without blocking a thread.
+//
+// Tasks are lazy, they don't begin until awaited, or handed off to
+// coro::start (fire and forget) or coro::syncWait (block for the result).
+//
+// -----------------------------------------------------------------
+namespace coro
+{
+    enum class Executor : std::uint8_t
+    {
+        Frame,      // thread pool worker, frame lane
+        Background, // thread pool worker, background lane
+        IO,         // the dedicated IO thread
+        Main        // the main thread, the next time it calls processMain
+    };
+
+    template <typename T = void>
+    class Task;
+
+    namespace detail
+    {
+        class PromiseBase
+        {
+          public:
+            struct FinalAwaiter
+            {
+                bool await_ready() noexcept { return false; }
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+                {
+                    auto continuation = handle.promise().getContinuation();
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+                void await_resume() noexcept {}
+            };
+
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            FinalAwaiter final_suspend() noexcept { return {}; }
+            void unhandled_exception() { m_exception = std::current_exception(); }
+
+            void setContinuation(std::coroutine_handle<> continuation) { m_continuation = continuation; }
+            std::coroutine_handle<> getContinuation() { return m_continuation; }
+
+          protected:
+            void rethrow()
+            {
+                if (m_exception)
+                {
+                    std::rethrow_exception(m_exception);
+                }
+            }
+
+          private:
+            std::coroutine_handle<> m_continuation;
+            std::exception_ptr m_exception;
+        };
+
+        template <typename T>
+        class Promise : public PromiseBase
+        {
+          public:
+            Task<T> get_return_object();
+
+            template <typename U>
+            void return_value(U&& value)
+            {
+                m_value.emplace(std::forward<U>(value));
+            }
+
+            T result()
+            {
+                rethrow();
+                return std::move(*m_value);
+            }
+
+          private:
+            std::optional<T> m_value;
+        };
+
+        template <>
+        class Promise<void> : public PromiseBase
+        {
+          public:
+            Task<void> get_return_object();
+
+            void return_void() {}
+            void result() { rethrow(); }
+        };
+
+        //
+        // A coroutine that starts right away and cleans itself up when done,
+        // used to get a lazy task going without anyone awaiting it.
+        class Detached
+        {
+          public:
+            struct promise_type
+            {
+                Detached get_return_object() { return {}; }
+                std::suspend_never initial_suspend() noexcept { return {}; }
+                std::suspend_never final_suspend() noexcept { return {}; }
+                void return_void() {}
+                void unhandled_exception() { std::terminate(); }
+            };
+        };
+    } // namespace detail
+
+    // -----------------------------------------------------------------
+    //
+    // Awaiting a task starts it, and the awaiting coroutine is resumed,
+    // on whichever thread the task finishes, with its result.
+    //
+    // -----------------------------------------------------------------
+    template <typename T>
+    class Task
+    {
+      public:
+        using promise_type = detail::Promise<T>;
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+        Task(Task&& rhs) noexcept :
+            m_handle(std::exchange(rhs.m_handle, nullptr))
+        {
+        }
+        Task& operator=(Task&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                if (m_handle)
+                {
+                    m_handle.destroy();
+                }
+                m_handle = std::exchange(rhs.m_handle, nullptr);
+            }
+            return *this;
+        }
+        ~Task()
+        {
+            if (m_handle)
+            {
+                m_handle.destroy();
+            }
+        }
+
+        bool await_ready() { return !m_handle || m_handle.done(); }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting)
+        {
+            m_handle.promise().setContinuation(awaiting);
+            return m_handle;
+        }
+        T await_resume() { return m_handle.promise().result(); }
+
+      private:
+        friend promise_type;
+
+        explicit Task(std::coroutine_handle<promise_type> handle) :
+            m_handle(handle)
+        {
+        }
+
+        std::coroutine_handle<promise_type> m_handle;
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        Task<T> Promise<T>::get_return_object()
+        {
+            return Task<T>{ std::coroutine_handle<Promise<T>>::from_promise(*this) };
+        }
+
+        inline Task<void> Promise<void>::get_return_object()
+        {
+            return Task<void>{ std::coroutine_handle<Promise<void>>::from_promise(*this) };
+        }
+
+        template <typename T>
+        Detached runDetached(Task<T> task)
+        {
+            co_await task;
+        }
+
+        //
+        // Resumes the awaiting coroutine once the count reaches zero.  The
+        // awaiting coroutine holds one count of its own, so whichever of it
+        // or the last arrival comes second does the resuming.
+        class CountDown
+        {
+          public:
+            CountDown(std::size_t count) :
+                m_remaining(count + 1)
+            {
+            }
+
+            void arrive()
+            {
+                if (m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    m_awaiting.resume();
+                }
+            }
+
+            bool await_ready() { return false; }
+            bool await_suspend(std::coroutine_handle<> awaiting)
+            {
+                m_awaiting = awaiting;
+                return m_remaining.fetch_sub(1, std::memory_order_acq_rel) > 1;
+            }
+            void await_resume() {}
+
+          private:
+            std::atomic_size_t m_remaining;
+            std::coroutine_handle<> m_awaiting;
+        };
+
+        template <typename T>
+        Detached runCounted(Task<T> task, CountDown& countDown, std::optional<T>& result, std::exception_ptr& error)
+        {
+            try
+            {
+                result.emplace(co_await task);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            countDown.arrive();
+        }
+
+        inline Detached runCounted(Task<void> task, CountDown& countDown, std::exception_ptr& error)
+        {
+            try
+            {
+                co_await task;
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            countDown.arrive();
+        }
+
+        template <typename T>
+        Detached runSignaled(Task<T> task, std::latch& done, std::optional<T>& result, std::exception_ptr& error)
+        {
+            try
+            {
+                result.emplace(co_await task);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            done.count_down();
+        }
+
+        inline Detached runSignaled(Task<void> task, std::latch& done, std::exception_ptr& error)
+        {
+            try
+            {
+                co_await task;
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            done.count_down();
+        }
+    } // namespace detail
+
+    // -----------------------------------------------------------------
+    //
+    // co_await scheduleOn(executor) suspends the coroutine and resumes
+    // it on a thread of the given executor.
+    //
+    // -----------------------------------------------------------------
+    class ScheduleOn
+    {
+      public:
+        ScheduleOn(Executor executor) :
+            m_executor(executor)
+        {
+        }
+
+        bool await_ready() { return false; }
+        void await_suspend(std::coroutine_handle<> handle);
+        void await_resume() {}
+
+      private:
+        Executor m_executor;
+    };
+
+    inline ScheduleOn scheduleOn(Executor executor)
+    {
+        return ScheduleOn{ executor };
+    }
+
+    // Resumes the coroutines waiting on the main thread, must only be called from the main thread
+    void processMain();
+
+    // -----------------------------------------------------------------
+    //
+    // Gets the task going with nobody awaiting its result.  An exception
+    // escaping the task terminates the program, same as an std::thread.
+    //
+    // -----------------------------------------------------------------
+    template <typename T>
+    void start(Task<T> task)
+    {
+        detail::runDetached(std::move(task));
+    }
+
+    // -----------------------------------------------------------------
+    //
+    // Blocks the calling thread until the task completes, returning its
+    // result.  Don't use from a thread the task needs in order to finish
+    // (e.g., the main thread, for a task that schedules on Main).
+    //
+    // -----------------------------------------------------------------
+    template <typename T>
+    T syncWait(Task<T> task)
+    {
+        std::latch done{ 1 };
+        std::exception_ptr error;
+        if constexpr (std::is_void_v<T>)
+        {
+            detail::runSignaled(std::move(task), done, error);
+            done.wait();
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+        else
+        {
+            std::optional<T> result;
+            detail::runSignaled(std::move(task), done, result, error);
+            done.wait();
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+            return std::move(*result);
+        }
+    }
+
+    // -----------------------------------------------------------------
+    //
+    // Starts all of the tasks at once, completing when every one of them
+    // has, with their results in the same order as the tasks.  If any of
+    // them failed, the first (in task order) exception is rethrown.
+    //
+    // -----------------------------------------------------------------
+    template <typename T>
+    Task<std::vector<T>> whenAll(std::vector<Task<T>> tasks)
+    {
+        std::vector<std::optional<T>> results(tasks.size());
+        std::vector<std::exception_ptr> errors(tasks.size());
+        detail::CountDown countDown{ tasks.size() };
+        for (std::size_t task = 0; task < tasks.size(); task++)
+        {
+            detail::runCounted(std::move(tasks[task]), countDown, results[task], errors[task]);
+        }
+        co_await countDown;
+
+        std::vector<T> values;
+        for (std::size_t task = 0; task < tasks.size(); task++)
+        {
+            if (errors[task])
+            {
+                std::rethrow_exception(errors[task]);
+            }
+            values.push_back(std::move(*results[task]));
+        }
+        co_return values;
+    }
+
+    inline Task<void> whenAll(std::vector<Task<void>> tasks)
+    {
+        std::vector<std::exception_ptr> errors(tasks.size());
+        detail::CountDown countDown{ tasks.size() };
+        for (std::size_t task = 0; task < tasks.size(); task++)
+        {
+            detail::runCounted(std::move(tasks[task]), countDown, errors[task]);
+        }
+        co_await countDown;
+
+        for (auto& error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+} // namespace coro
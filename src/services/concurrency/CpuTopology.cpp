@@ -0,0 +1,192 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "CpuTopology.hpp"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <utility>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#elif defined(__linux__)
+    #include <fstream>
+    #include <pthread.h>
+    #include <sched.h>
+    #include <string>
+#endif
+
+// -----------------------------------------------------------------
+//
+// Groups the logical processors available to this process by the
+// physical core they belong to.  If the platform doesn't tell us,
+// every logical processor is treated as its own core.
+//
+// -----------------------------------------------------------------
+CpuTopology CpuTopology::detect()
+{
+    CpuTopology topology;
+
+#if defined(_WIN32)
+    DWORD_PTR processMask{ 0 };
+    DWORD_PTR systemMask{ 0 };
+    GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask);
+
+    DWORD length{ 0 };
+    GetLogicalProcessorInformation(nullptr, &length);
+    std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+    if (!info.empty() && GetLogicalProcessorInformation(info.data(), &length))
+    {
+        for (auto& item : info)
+        {
+            if (item.Relationship != RelationProcessorCore)
+            {
+                continue;
+            }
+            Core core;
+            for (std::uint32_t processor = 0; processor < sizeof(ULONG_PTR) * 8; processor++)
+            {
+                auto bit = static_cast<ULONG_PTR>(1) << processor;
+                if ((item.ProcessorMask & bit) && (processMask & bit))
+                {
+                    core.push_back(processor);
+                }
+            }
+            if (!core.empty())
+            {
+                topology.m_cores.push_back(core);
+            }
+        }
+    }
+#elif defined(__linux__)
+    //
+    // Only the processors we are allowed to run on, which may be fewer than
+    // the machine has, when restricted by taskset, cgroups, and so on.
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0)
+    {
+        auto readId = [](std::uint32_t processor, const std::string& name)
+        {
+            std::ifstream in("/sys/devices/system/cpu/cpu" + std::to_string(processor) + "/topology/" + name);
+            int id{ -1 };
+            in >> id;
+            return in ? id : -1;
+        };
+
+        std::map<std::pair<int, int>, Core> cores;
+        for (std::uint32_t processor = 0; processor < CPU_SETSIZE; processor++)
+        {
+            if (!CPU_ISSET(processor, &allowed))
+            {
+                continue;
+            }
+            auto package = readId(processor, "physical_package_id");
+            auto coreId = readId(processor, "core_id");
+            if (package < 0 || coreId < 0)
+            {
+                // Unknown, so a core of its own, keyed so it can't collide with a real one
+                package = -1;
+                coreId = static_cast<int>(processor);
+            }
+            cores[{ package, coreId }].push_back(processor);
+        }
+        for (auto& [id, core] : cores)
+        {
+            topology.m_cores.push_back(core);
+        }
+    }
+#endif
+
+    if (topology.m_cores.empty())
+    {
+        for (std::uint32_t processor = 0; processor < std::max(1u, std::thread::hardware_concurrency()); processor++)
+        {
+            topology.m_cores.push_back({ processor });
+        }
+    }
+
+    // Ordered by the first logical processor, so core 0 is the one the OS usually favors
+    std::ranges::sort(topology.m_cores, [](const Core& lhs, const Core& rhs)
+                      {
+                          return lhs.front() < rhs.front();
+                      });
+
+    return topology;
+}
+
+std::size_t CpuTopology::logicalProcessors() const
+{
+    return std::accumulate(m_cores.begin(), m_cores.end(), std::size_t{ 0 }, [](std::size_t total, const Core& core)
+                           {
+                               return total + core.size();
+                           });
+}
+
+// -----------------------------------------------------------------
+//
+// Restricts the thread to run only on the given logical processors.
+// Returns false if the platform doesn't support it or it failed, in
+// which case the thread is left free to run anywhere.
+//
+// -----------------------------------------------------------------
+bool CpuTopology::pin([[maybe_unused]] std::thread::native_handle_type thread, [[maybe_unused]] const std::vector<std::uint32_t>& processors)
+{
+    if (processors.empty())
+    {
+        return false;
+    }
+
+#if defined(_WIN32)
+    DWORD_PTR mask{ 0 };
+    for (auto processor : processors)
+    {
+        mask |= static_cast<DWORD_PTR>(1) << processor;
+    }
+    return SetThreadAffinityMask(static_cast<HANDLE>(thread), mask) != 0;
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto processor : processors)
+    {
+        CPU_SET(processor, &set);
+    }
+    return pthread_setaffinity_np(thread, sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+bool CpuTopology::pinCurrentThread([[maybe_unused]] const std::vector<std::uint32_t>& processors)
+{
+#if defined(_WIN32)
+    return pin(GetCurrentThread(), processors);
+#elif defined(__linux__)
+    return pin(pthread_self(), processors);
+#else
+    return false;
+#endif
+}
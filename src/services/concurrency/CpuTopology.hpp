@@ -0,0 +1,54 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------
+//
+// Describes the cores the process is allowed to run on, with the
+// logical processors (SMT siblings) grouped by the physical core
+// they share.  Also provides the platform specific pinning of a
+// thread to a set of logical processors.
+//
+// -----------------------------------------------------------------
+class CpuTopology
+{
+  public:
+    using Core = std::vector<std::uint32_t>; // logical processor ids of one physical core
+
+    static CpuTopology detect();
+
+    static bool pin(std::thread::native_handle_type thread, const std::vector<std::uint32_t>& processors);
+    static bool pinCurrentThread(const std::vector<std::uint32_t>& processors);
+
+    auto physicalCores() const { return m_cores.size(); }
+    std::size_t logicalProcessors() const;
+    const Core& core(std::size_t index) const { return m_cores[index]; }
+
+  private:
+    std::vector<Core> m_cores;
+};
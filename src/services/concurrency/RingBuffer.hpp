@@ -0,0 +1,237 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <utility>
+#include <vector>
+
+// ------------------------------------------------------------------
+//
+// @details A bounded, lock-free ring buffer.  Any number of threads may
+// enqueue and dequeue.  Each slot carries a sequence number that says
+// whether it is ready to be written or read, which is what lets producers
+// and consumers claim slots without taking a lock.
+//
+// Items are constructed in a slot when enqueued and destroyed as soon as
+// they are dequeued, so T doesn't need to be default constructible and a
+// slot never holds on to what a dequeued item owned.
+//
+// Enqueuing onto a full buffer fails rather than blocking or growing,
+// it is up to the client code to decide what dropping an item means.
+//
+// Reference: https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+//
+// ------------------------------------------------------------------
+template <typename T, std::size_t Capacity>
+class RingBuffer
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+  public:
+    RingBuffer()
+    {
+        for (std::size_t i = 0; i < Capacity; i++)
+        {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~RingBuffer()
+    {
+        while (dequeue().has_value())
+            ;
+    }
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    // ------------------------------------------------------------------
+    //
+    // Returns false if the buffer is full, safe to call from any thread
+    //
+    // ------------------------------------------------------------------
+    bool enqueue(const T& item)
+    {
+        return enqueueBulk(&item, 1) == 1;
+    }
+
+    // ------------------------------------------------------------------
+    //
+    // Claims as many of the next slots as are free, up to count, with a
+    // single update of the tail.  Returns how many items were enqueued,
+    // which is 0 if the buffer is full.
+    //
+    // ------------------------------------------------------------------
+    std::size_t enqueueBulk(const T* items, std::size_t count)
+    {
+        auto position = m_tail.load(std::memory_order_relaxed);
+        while (count > 0)
+        {
+            auto free = countReady(position, count, 0);
+            if (free > 0)
+            {
+                if (m_tail.compare_exchange_weak(position, position + free, std::memory_order_relaxed))
+                {
+                    for (std::size_t i = 0; i < free; i++)
+                    {
+                        auto& slot = m_slots[(position + i) & MASK];
+                        new (slot.storage) T(items[i]);
+                        slot.sequence.store(position + i + 1, std::memory_order_release);
+                    }
+                    return free;
+                }
+            }
+            else if (difference(position, 0) < 0)
+            {
+                return 0;
+            }
+            else
+            {
+                position = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        return 0;
+    }
+
+    // ------------------------------------------------------------------
+    //
+    // Returns an empty optional if the buffer is empty, safe to call
+    // from any thread
+    //
+    // ------------------------------------------------------------------
+    std::optional<T> dequeue()
+    {
+        std::optional<T> item;
+        dequeueBulk(1, [&item](T&& value)
+                    {
+                        item.emplace(std::move(value));
+                    });
+        return item;
+    }
+
+    // ------------------------------------------------------------------
+    //
+    // Takes up to count items with a single update of the head, handing
+    // each to onItem in order.  Returns how many were taken.
+    //
+    // ------------------------------------------------------------------
+    template <typename OnItem>
+    std::size_t dequeueBulk(std::size_t count, OnItem&& onItem)
+    {
+        auto position = m_head.load(std::memory_order_relaxed);
+        while (count > 0)
+        {
+            auto ready = countReady(position, count, 1);
+            if (ready > 0)
+            {
+                if (m_head.compare_exchange_weak(position, position + ready, std::memory_order_relaxed))
+                {
+                    for (std::size_t i = 0; i < ready; i++)
+                    {
+                        auto& slot = m_slots[(position + i) & MASK];
+                        auto item = std::launder(reinterpret_cast<T*>(slot.storage));
+                        onItem(std::move(*item));
+                        std::destroy_at(item);
+                        slot.sequence.store(position + i + Capacity, std::memory_order_release);
+                    }
+                    return ready;
+                }
+            }
+            else if (difference(position, 1) < 0)
+            {
+                return 0;
+            }
+            else
+            {
+                position = m_head.load(std::memory_order_relaxed);
+            }
+        }
+
+        return 0;
+    }
+
+    std::size_t dequeueBulk(std::vector<T>& items, std::size_t count)
+    {
+        return dequeueBulk(count, [&items](T&& value)
+                           {
+                               items.push_back(std::move(value));
+                           });
+    }
+
+    // ------------------------------------------------------------------
+    //
+    // The number of items in the buffer, which may already be out of date
+    // by the time it is returned.  The head is read before the tail, so it
+    // never comes out ahead of it.
+    //
+    // ------------------------------------------------------------------
+    std::size_t sizeApprox() const
+    {
+        auto head = m_head.load(std::memory_order_acquire);
+        auto tail = m_tail.load(std::memory_order_acquire);
+
+        return tail > head ? tail - head : 0;
+    }
+
+  private:
+    static constexpr std::size_t MASK = Capacity - 1;
+    // Keeps the producer and consumer counters from sharing a cache line
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    std::array<Slot, Capacity> m_slots;
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_tail{ 0 };
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_head{ 0 };
+
+    // A slot at the position is ready to be written when its sequence equals the
+    // position (offset 0), and ready to be read once it is one past (offset 1).
+    std::intptr_t difference(std::size_t position, std::size_t offset) const
+    {
+        auto sequence = m_slots[position & MASK].sequence.load(std::memory_order_acquire);
+        return static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + offset);
+    }
+
+    std::size_t countReady(std::size_t position, std::size_t count, std::size_t offset) const
+    {
+        std::size_t ready{ 0 };
+        while (ready < count && ready < Capacity && difference(position + ready, offset) == 0)
+        {
+            ready++;
+        }
+        return ready;
+    }
+};
@@ -30,9 +30,10 @@ THE SOFTWARE.
 // is assigned to the task.
 //
 // -----------------------------------------------------------------
-Task::Task(std::uint64_t graphId, bool isIO, std::function<void()> job, std::function<void()> onComplete) :
+Task::Task(std::uint64_t graphId, bool isIO, std::function<void()> job, std::function<void()> onComplete, Priority priority) :
     m_graphId(graphId),
     m_isIO(isIO),
+    m_priority(priority),
     m_job(job),
     m_onComplete(onComplete)
 {
@@ -33,17 +33,28 @@ THE SOFTWARE.
 class Task final
 {
   public:
-    Task(std::uint64_t graphId, bool isIO, std::function<void()> job, std::function<void()> onComplete = nullptr);
+    //
+    // Frame tasks are the ones the current frame is waiting on, they are
+    // always taken ahead of any background tasks.
+    enum class Priority : std::uint8_t
+    {
+        Frame,
+        Background
+    };
+
+    Task(std::uint64_t graphId, bool isIO, std::function<void()> job, std::function<void()> onComplete = nullptr, Priority priority = Priority::Frame);
 
     std::uint64_t getId() const { return m_id; }
     std::uint64_t getGraphId() const { return m_graphId; }
     auto isIO() { return m_isIO; }
+    auto getPriority() { return m_priority; }
     void execute();
 
   private:
     std::uint64_t m_id;
     std::uint64_t m_graphId{ 0 };
     bool m_isIO;
+    Priority m_priority;
     std::function<void()> m_job;
     std::function<void()> m_onComplete;
 };
@@ -22,22 +22,24 @@ THE SOFTWARE.
 
 #include "WorkerThread.hpp"
 
+#include "CpuTopology.hpp"
 #include "services/ThreadPool.hpp"
 
 #include <mutex>
 #include <optional>
+#include <utility>
 
 // ------------------------------------------------------------------
 //
 // @details This constructor gets the underlying thread created
-// along with saving references to the work queue, work queue event,
-// and the number of available threads counter.
+// along with saving references to the work queues (in priority order),
+// work queue event, and the number of available threads counter.
 //
 // ------------------------------------------------------------------
-WorkerThread::WorkerThread(ConcurrentQueue<std::shared_ptr<Task>>& workQueue, std::condition_variable& eventWorkQueue, std::mutex& mutexWorkQueueEvent) :
+WorkerThread::WorkerThread(std::vector<ConcurrentQueue<std::shared_ptr<Task>>*> lanes, std::condition_variable& eventWorkQueue, std::mutex& mutexWorkQueueEvent) :
     m_thread(nullptr),
     m_done(false),
-    m_workQueue(workQueue),
+    m_lanes(std::move(lanes)),
     m_eventWorkQueue(eventWorkQueue),
     m_mutexWorkQueueEvent(mutexWorkQueueEvent)
 {
@@ -48,15 +50,19 @@ WorkerThread::WorkerThread(ConcurrentQueue<std::shared_ptr<Task>>& workQueue, st
 //
 // @details This is the entry point method for the actual worker thread.  This
 // method stays running until we are asked to voluntarily terminate.  The
-// thread waits on a signal to check for something in the work queue.  If there
-// is something in the queue, it goes to work.
+// thread waits on a signal to check for something in the work queues.  If there
+// is something in any of them, it goes to work on the one with the highest priority.
 //
 // ------------------------------------------------------------------
 void WorkerThread::run()
 {
     while (!m_done)
     {
-        std::optional<std::shared_ptr<Task>> task = m_workQueue.dequeue();
+        std::optional<std::shared_ptr<Task>> task;
+        for (auto lane = m_lanes.begin(); !task && lane != m_lanes.end(); lane++)
+        {
+            task = (*lane)->dequeue();
+        }
         if (task)
         {
             task.value()->execute();
@@ -91,3 +97,13 @@ void WorkerThread::join()
 {
     m_thread->join();
 }
+
+// ------------------------------------------------------------------
+//
+// @details Restricts the thread to the given logical processors
+//
+// ------------------------------------------------------------------
+bool WorkerThread::pin(const std::vector<std::uint32_t>& processors)
+{
+    return CpuTopology::pin(m_thread->native_handle(), processors);
+}
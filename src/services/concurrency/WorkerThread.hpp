@@ -26,32 +26,37 @@ THE SOFTWARE.
 #include "Task.hpp"
 
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 // -----------------------------------------------------------------
 //
 // This class provides the implementation for worker threads
 // throughout the system.  It provides the key functionality that knows
 // how to effeciently wait on a work queue, then, as tasks become
-// available, it grabs the next one and works on it.
+// available, it grabs the next one and works on it.  A worker may
+// serve several queues (lanes), always taking from the earliest
+// lane that has a task.
 //
 // -----------------------------------------------------------------
 class WorkerThread
 {
   public:
-    WorkerThread(ConcurrentQueue<std::shared_ptr<Task>>& workQueue, std::condition_variable& eventWorkQueue, std::mutex& mutexWorkQueueEvent);
+    WorkerThread(std::vector<ConcurrentQueue<std::shared_ptr<Task>>*> lanes, std::condition_variable& eventWorkQueue, std::mutex& mutexWorkQueueEvent);
 
     void run();
     void terminate();
     void join();
+    bool pin(const std::vector<std::uint32_t>& processors);
 
   private:
     std::thread* m_thread; // Have to manage the memory ourselves, do NOT delete when finished!
     bool m_done;
 
-    ConcurrentQueue<std::shared_ptr<Task>>& m_workQueue;
+    std::vector<ConcurrentQueue<std::shared_ptr<Task>>*> m_lanes;
     std::condition_variable& m_eventWorkQueue;
     std::mutex& m_mutexWorkQueueEvent;
 };
@@ -28,6 +28,7 @@ THE SOFTWARE.
 #include "services/ControllerInput.hpp"
 #include "services/KeyboardInput.hpp"
 #include "services/MouseInput.hpp"
+#include "services/Replay.hpp"
 
 #include <algorithm> // std::max
 
@@ -96,6 +97,7 @@ namespace systems
         {
             auto input = m_inputDirection.front();
             m_inputDirection.pop();
+            Replay::instance().record(Replay::Action::Camera, misc::as_integer(input));
 
             switch (input)
             {
@@ -322,11 +324,11 @@ namespace systems
                 // the zoom to work correctly
                 if (event.delta > 0)
                 {
-                    m_inputDirection.push(Configuration::get<bool>(config::MOUSE_CAMERA_INVERT_ZOOM) ? Input::ZoomIn : Input::ZoomOut);
+                    m_inputDirection.push(m_invertZoom.get() ? Input::ZoomIn : Input::ZoomOut);
                 }
                 else if (event.delta < 0)
                 {
-                    m_inputDirection.push(Configuration::get<bool>(config::MOUSE_CAMERA_INVERT_ZOOM) ? Input::ZoomOut : Input::ZoomIn);
+                    m_inputDirection.push(m_invertZoom.get() ? Input::ZoomOut : Input::ZoomIn);
                 }
             });
 
@@ -346,25 +348,25 @@ namespace systems
 
                     while (vector.x > cellSize.x)
                     {
-                        m_inputDirection.push(Configuration::get<bool>(config::MOUSE_CAMERA_INVERT_PAN_HORZ) ? Input::Left : Input::Right);
+                        m_inputDirection.push(m_invertPanHorz.get() ? Input::Left : Input::Right);
                         vector.x -= cellSize.x;
                         panX = true;
                     }
                     while (vector.x < -cellSize.x)
                     {
-                        m_inputDirection.push(Configuration::get<bool>(config::MOUSE_CAMERA_INVERT_PAN_HORZ) ? Input::Right : Input::Left);
+                        m_inputDirection.push(m_invertPanHorz.get() ? Input::Right : Input::Left);
                         vector.x += cellSize.x;
                         panX = true;
                     }
                     while (vector.y > cellSize.y)
                     {
-                        m_inputDirection.push(Configuration::get<bool>(config::MOUSE_CAMERA_INVERT_PAN_VERT) ? Input::Up : Input::Down);
+                        m_inputDirection.push(m_invertPanVert.get() ? Input::Up : Input::Down);
                         vector.y -= cellSize.y;
                         panY = true;
                     }
                     while (vector.y < -cellSize.y)
                     {
-                        m_inputDirection.push(Configuration::get<bool>(config::MOUSE_CAMERA_INVERT_PAN_VERT) ? Input::Down : Input::Up);
+                        m_inputDirection.push(m_invertPanVert.get() ? Input::Down : Input::Up);
                         vector.y += cellSize.y;
                         panY = true;
                     }
@@ -437,31 +439,31 @@ namespace systems
         { // Pan
             if (m_axisUpDown < -SENSITIVITY_GENERAL && std::abs(m_axisUpDown) > std::abs(m_axisLeftRight))
             {
-                direction = Configuration::get<bool>(config::MOUSE_CAMERA_INVERT_PAN_VERT) ? Input::Up : Input::Down;
+                direction = m_invertPanVert.get() ? Input::Up : Input::Down;
             }
             if (m_axisUpDown > SENSITIVITY_GENERAL && std::abs(m_axisUpDown) > std::abs(m_axisLeftRight))
             {
-                direction = Configuration::get<bool>(config::MOUSE_CAMERA_INVERT_PAN_VERT) ? Input::Down : Input::Up;
+                direction = m_invertPanVert.get() ? Input::Down : Input::Up;
             }
 
             if (m_axisLeftRight < -SENSITIVITY_GENERAL && std::abs(m_axisLeftRight) > std::abs(m_axisUpDown))
             {
-                direction = Configuration::get<bool>(config::MOUSE_CAMERA_INVERT_PAN_HORZ) ? Input::Left : Input::Right;
+                direction = m_invertPanHorz.get() ? Input::Left : Input::Right;
             }
             if (m_axisLeftRight > SENSITIVITY_GENERAL && std::abs(m_axisLeftRight) > std::abs(m_axisUpDown))
             {
-                direction = Configuration::get<bool>(config::MOUSE_CAMERA_INVERT_PAN_HORZ) ? Input::Right : Input::Left;
+                direction = m_invertPanHorz.get() ? Input::Right : Input::Left;
             }
         }
         else // Zoom
         {
             if (m_axisUpDown > SENSITIVITY_GENERAL)
             {
-                direction = Configuration::get<bool>(config::MOUSE_CAMERA_INVERT_ZOOM) ? Input::ZoomOut : Input::ZoomIn;
+                direction = m_invertZoom.get() ? Input::ZoomOut : Input::ZoomIn;
             }
             if (m_axisUpDown < -SENSITIVITY_GENERAL)
             {
-                direction = Configuration::get<bool>(config::MOUSE_CAMERA_INVERT_ZOOM) ? Input::ZoomIn : Input::ZoomOut;
+                direction = m_invertZoom.get() ? Input::ZoomIn : Input::ZoomOut;
             }
         }
 
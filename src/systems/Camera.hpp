@@ -26,6 +26,8 @@ THE SOFTWARE.
 #include "components/Camera.hpp"
 #include "misc/math.hpp"
 #include "misc/misc.hpp"
+#include "services/Configuration.hpp"
+#include "services/ConfigurationPath.hpp"
 
 #include <functional>
 #include <optional>
@@ -35,6 +37,7 @@ namespace systems
 {
     class Camera : public System
     {
+      public:
         enum class Input : std::uint8_t
         {
             Up,
@@ -45,13 +48,14 @@ namespace systems
             ZoomOut
         };
 
-      public:
         Camera(std::uint16_t levelWidth, std::uint16_t levelHeight, std::function<void(math::Vector2f diff)> notifyPan, std::function<void()> notifyZoom);
 
         void update(std::chrono::microseconds elapsedTime) override;
         void shutdown() override;
 
         auto getCamera() { return m_entities.begin()->second; }
+        // Used to inject camera input that didn't come from the input devices (e.g., replays)
+        void signalInput(Input input) { m_inputDirection.push(input); }
 
       private:
         std::uint16_t m_levelWidth;
@@ -63,6 +67,9 @@ namespace systems
         std::uint8_t m_cameraMaxRange;
         bool m_mouseCapture{ false };
         math::Point2f m_previousMousePoint{ 0, 0 };
+        Configuration::Value<bool> m_invertZoom{ config::MOUSE_CAMERA_INVERT_ZOOM };
+        Configuration::Value<bool> m_invertPanHorz{ config::MOUSE_CAMERA_INVERT_PAN_HORZ };
+        Configuration::Value<bool> m_invertPanVert{ config::MOUSE_CAMERA_INVERT_PAN_VERT };
 
         std::vector<std::uint32_t> m_keyboardInputHandlers;
         std::uint32_t m_mouseWheelHandlerId{ 0 };
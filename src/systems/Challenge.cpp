@@ -96,7 +96,7 @@ namespace systems
                     m_challenges.pop();
                 }
 
-                auto challenge = std::make_shared<entities::Entity>();
+                auto challenge = entities::create();
                 challenge->addComponent(std::make_unique<components::Challenge>("All Challenges Complete"));
                 m_addEntity(challenge);
             }
@@ -125,7 +125,7 @@ namespace systems
             return total;
         };
 
-        auto challenge = std::make_shared<entities::Entity>();
+        auto challenge = entities::create();
         if (!m_challenges.empty())
         {
             auto group = m_challenges.front();
@@ -28,6 +28,7 @@ THE SOFTWARE.
 #include <cassert>
 #include <map>
 #include <ranges>
+#include <unordered_set>
 
 namespace systems
 {
@@ -40,45 +41,32 @@ namespace systems
     // --------------------------------------------------------------
     void Completion::update([[maybe_unused]] std::chrono::microseconds elapsedTime)
     {
-        const auto hasGoal = [this](auto colocated)
+        // Let's go through all the I entities to find where they are, then through all the Goal
+        // entities to see if any of them are in the same position.  We can have the condition that
+        // an I object can also be a Goal object, that is counted, but each Goal entity only once.
+        std::unordered_set<misc::HexCoord> iPositions;
+        for (auto&& entity : m_entities | std::views::values)
         {
-            if (m_markedForRemoval(colocated->getId()))
-            {
-                return false;
-            }
-            return colocated->template hasComponent<components::Property>() &&
-                   colocated->template getComponent<components::Property>()->has(components::PropertyType::Goal);
-        };
+            iPositions.insert(entity->getComponent<components::Position>()->get());
+        }
 
-        // Let's go through all the I entities, get the entities at those positions
-        // in the level and see if there are an Goal entities in the same position.
-        std::unordered_set<entities::Entity::IdType> alreadyCounted;
         bool completed{ false };
         std::map<components::ObjectType, std::uint16_t> score;
-
-        for (auto&& entity : m_entities | std::views::values)
+        for (auto&& goal : m_goals)
         {
-            auto position = entity->getComponent<components::Position>()->get();
-
-            for (auto&& goal : m_level->getEntities(position) | std::views::values | std::views::filter(hasGoal))
+            if (m_markedForRemoval(goal->getId()) || !iPositions.contains(goal->getComponent<components::Position>()->get()))
             {
-                // We can have the condition that an I object can also be an Goal object.  We want to count that
-                // but not double count it if there are two (or more) I & Goal objects in the same position.  To handle this,
-                // once a Goal entity has been counted, we don't look at it again.
-                if (!alreadyCounted.contains(goal->getId()))
-                {
-                    completed = true;
+                continue;
+            }
+            completed = true;
 
-                    assert(goal->hasComponent<components::Object>());
-                    auto object = goal->getComponent<components::Object>()->getType();
-                    if (!score.contains(object))
-                    {
-                        score.insert({ object, static_cast<std::uint16_t>(0) });
-                    }
-                    score[object]++;
-                    alreadyCounted.insert(goal->getId());
-                }
+            assert(goal->hasComponent<components::Object>());
+            auto object = goal->getComponent<components::Object>()->getType();
+            if (!score.contains(object))
+            {
+                score.insert({ object, static_cast<std::uint16_t>(0) });
             }
+            score[object]++;
         }
 
         if (completed)
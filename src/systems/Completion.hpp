@@ -44,8 +44,10 @@ namespace systems
                      ctti::unnamed_type_id<components::Property>() }),
             m_level(level),
             m_notifyCompletion(notifyCompletion),
-            m_markedForRemoval(markedForRemoval)
+            m_markedForRemoval(markedForRemoval),
+            m_goals(Query().with<components::Position>().with(components::PropertyType::Goal))
         {
+            declare(m_goals);
         }
 
         void update(std::chrono::microseconds elapsedTime) override;
@@ -57,5 +59,6 @@ namespace systems
         std::shared_ptr<Level> m_level;
         std::function<void(const Scoring::ChallengeGroup&)> m_notifyCompletion;
         std::function<bool(const entities::Entity::IdType)> m_markedForRemoval;
+        Query m_goals;
     };
 } // namespace systems
@@ -34,6 +34,7 @@ THE SOFTWARE.
 #include "services/ConfigurationPath.hpp"
 #include "services/ControllerInput.hpp"
 #include "services/KeyboardInput.hpp"
+#include "services/Replay.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -42,11 +43,6 @@ THE SOFTWARE.
 
 namespace systems
 {
-    const static auto canSend = [](auto entity)
-    {
-        return entity->template hasComponent<components::Ability>() && entity->template getComponent<components::Ability>()->has(components::AbilityType::Send);
-    };
-
     Movement::Movement(std::shared_ptr<Level> level, std::function<void()> signalMovement, std::function<void(entities::Entity::IdType)> notifyUpdated) :
         System({ ctti::unnamed_type_id<components::Position>(),
                  ctti::unnamed_type_id<components::InputControlled>() }),
@@ -82,6 +78,7 @@ namespace systems
 
         if (m_inputDirection)
         {
+            Replay::instance().record(m_withPull ? Replay::Action::MoveWithPull : Replay::Action::Move, misc::as_integer(m_inputDirection.value()));
             m_audioPlayed = false;
             m_anyMoved = false;
 
@@ -123,9 +120,9 @@ namespace systems
         bool added{ false };
         if (added = System::addEntity(entity); !added)
         {
-            if (canSend(entity))
+            if (m_senders.matches(entity))
             {
-                m_sendByPosition[entity->getComponent<components::Position>()->get()] = entity;
+                addSendPortal(entity);
                 added = true;
             }
         }
@@ -135,11 +132,7 @@ namespace systems
 
     void Movement::removeEntity(entities::Entity::IdType entityId)
     {
-        if (m_entities.contains(entityId) && m_entities[entityId]->hasComponent<components::Position>())
-        {
-            m_sendByPosition.erase(m_entities[entityId]->getComponent<components::Position>()->get());
-        }
-
+        removeSendPortal(entityId);
         System::removeEntity(entityId);
     }
 
@@ -152,33 +145,26 @@ namespace systems
     // --------------------------------------------------------------
     void Movement::updatedEntity(entities::EntityPtr entity)
     {
-        // Because the lambda is static, have to pass the send entities container in
-        // as a parameter, otherwise the container will become invalid after the
-        // second GameModel instance is created.
-        static const auto isTracked = [](const entities::EntityPtr& entity, const std::unordered_map<misc::HexCoord, entities::EntityPtr>& entities)
+        auto tracked = std::ranges::find_if(m_sendPortals, [&entity](const SendPortal& portal)
+                                            {
+                                                return portal.entity->getId() == entity->getId();
+                                            });
+        if (tracked != m_sendPortals.end())
         {
-            if (entity->hasComponent<components::Position>())
+            if (!m_senders.matches(entity))
             {
-                auto position = entity->getComponent<components::Position>()->get();
-                if (entities.contains(position) && entity->getId() == entities.at(position)->getId())
-                {
-                    return true;
-                }
+                removeSendPortal(entity->getId());
             }
-
-            return false;
-        };
-
-        if (isTracked(entity, m_sendByPosition))
-        {
-            if (!canSend(entity))
+            else if (tracked->position != entity->getComponent<components::Position>()->get())
             {
-                m_sendByPosition.erase(entity->getComponent<components::Position>()->get());
+                // It was moved, so it goes into a different place in the ordering
+                removeSendPortal(entity->getId());
+                addSendPortal(entity);
             }
         }
-        else if (canSend(entity))
+        else if (m_senders.matches(entity))
         {
-            m_sendByPosition[entity->getComponent<components::Position>()->get()] = entity;
+            addSendPortal(entity);
         }
         else
         {
@@ -186,6 +172,47 @@ namespace systems
         }
     }
 
+    // --------------------------------------------------------------
+    //
+    // The send entities are kept sorted by (r, q), so finding the one
+    // at a position is a binary search.
+    //
+    // --------------------------------------------------------------
+    std::vector<Movement::SendPortal>::iterator Movement::findSendPortal(const misc::HexCoord& position)
+    {
+        return std::ranges::lower_bound(m_sendPortals, std::make_pair(position.r, position.q), std::less{}, [](const SendPortal& portal)
+                                        {
+                                            return std::make_pair(portal.position.r, portal.position.q);
+                                        });
+    }
+
+    void Movement::addSendPortal(entities::EntityPtr entity)
+    {
+        if (!entity->hasComponent<components::Position>())
+        {
+            return;
+        }
+
+        auto position = entity->getComponent<components::Position>()->get();
+        auto itr = findSendPortal(position);
+        if (itr != m_sendPortals.end() && itr->position == position)
+        {
+            itr->entity = entity;
+        }
+        else
+        {
+            m_sendPortals.insert(itr, { position, entity });
+        }
+    }
+
+    void Movement::removeSendPortal(entities::Entity::IdType entityId)
+    {
+        std::erase_if(m_sendPortals, [entityId](const SendPortal& portal)
+                      {
+                          return portal.entity->getId() == entityId;
+                      });
+    }
+
     void Movement::registerKeyboardInput()
     {
         static const auto keyboardRepeatDelay = misc::msTous(std::chrono::milliseconds(Configuration::get<std::uint16_t>(config::KEYBOARD_REPEAT_DELAY)));
@@ -460,102 +487,108 @@ namespace systems
         m_pulls.clear();
     }
 
+    // --------------------------------------------------------------
+    //
+    // An entity with these abilities is able to move into this cell,
+    // not counting anything it might have to push out of the way.
+    //
+    // --------------------------------------------------------------
+    bool Movement::canEnter(components::Ability* ability, const misc::HexCoord& cell)
+    {
+        auto& summary = m_level->getSummary(cell);
+
+        return m_level->isValid(cell) &&
+               !summary.has(components::PropertyType::Stop) &&
+               (!summary.has(components::PropertyType::Steep) || ability->has(components::AbilityType::Climb));
+    }
+
     // --------------------------------------------------------------
     //
     // This is where the work of moving, stopping, pushing of entities
-    // is done.
+    // is done.  All the pushables in a cell move together into the
+    // next cell along the direction, so a push is resolved by walking
+    // cell by cell along the direction until nothing more is being
+    // pushed.  If every step can be made, the walk is repeated to
+    // record the moves.
     //
     // --------------------------------------------------------------
     bool Movement::move(entities::EntityPtr entity, misc::HexCoord::Direction direction)
     {
-        static const auto hasMovementProperties = [](entities::EntityPtr entity)
+        static const auto isPushable = [](const entities::EntityPtr& entity)
         {
-            bool interested{ false };
-
-            if (entity->hasComponent<components::Property>())
-            {
-                auto property = entity->getComponent<components::Property>();
-                interested = interested || property->has(components::PropertyType::Pushable);
-                interested = interested || property->has(components::PropertyType::Stop);
-                interested = interested || property->has(components::PropertyType::Steep);
-            }
-
-            return interested;
+            return entity->hasComponent<components::Property>() && entity->getComponent<components::Property>()->has(components::PropertyType::Pushable);
         };
-        bool moved{ false };
+        // A chain that loops back on itself through send entities could never be resolved
+        const auto maxSteps = static_cast<std::size_t>(m_level->getWidth()) * static_cast<std::size_t>(m_level->getHeight());
 
-        //
-        // Start by finding the coordinates for where this entity wants to move, because
-        // we are going to recursively check entities at that location to see if they moved
-        // or stop things
-        auto compPosition = entity->getComponent<components::Position>();
-        auto proposed = misc::HexCoord::getNextCell(compPosition->get(), direction);
+        auto ability = entity->getComponent<components::Ability>();
+        auto proposed = misc::HexCoord::getNextCell(entity->getComponent<components::Position>()->get(), direction);
         proposed = transformBySend(proposed, direction);
-
-        //
-        // Find the entities, if any, that can impact movement or cascade movement in some way
-        std::vector<entities::EntityPtr> tryThese;
-        for (auto&& neighbor : m_level->getEntities(proposed) | std::views::values | std::views::filter(hasMovementProperties))
+        if (!canEnter(ability, proposed))
         {
-            tryThese.push_back(neighbor);
+            return false;
         }
 
-        // First have to go through the neighbors to see if it could possibly move
-        bool canMove{ true };
-        for (auto ability = entity->getComponent<components::Ability>(); auto&& neighbor : tryThese)
+        //
+        // Find out if everything being pushed is able to move
+        bool pushing = ability->has(components::AbilityType::Push) && m_level->getSummary(proposed).pushables > 0;
+        auto cell = proposed;
+        for (std::size_t step = 0; pushing; step++)
         {
-            auto property = neighbor->getComponent<components::Property>();
-            if (property->has(components::PropertyType::Steep) && !ability->has(components::AbilityType::Climb))
+            if (step == maxSteps)
             {
-                canMove = false;
+                return false;
             }
-            if (property->has(components::PropertyType::Stop))
-            {
-                canMove = false;
-            }
-        }
 
-        // Once we know if it could move, then we check for ability to push, because that can also impact
-        // whether or not the entity could move
-        if (canMove)
-        {
-            bool canPush{ true };
-            for (auto ability = entity->getComponent<components::Ability>(); auto&& neighbor : tryThese)
+            auto next = transformBySend(misc::HexCoord::getNextCell(cell, direction), direction);
+            bool anyPush{ false };
+            for (auto&& neighbor : m_level->getEntities(cell) | std::views::values | std::views::filter(isPushable))
             {
-                auto property = neighbor->getComponent<components::Property>();
-                if (property->has(components::PropertyType::Pushable) && ability->has(components::AbilityType::Push))
+                auto neighborAbility = neighbor->getComponent<components::Ability>();
+                if (!canEnter(neighborAbility, next))
                 {
-                    // Recursively try to move the neighbor
-                    canMove = canMove && move(neighbor, direction);
-                    canPush = canPush && true;
+                    return false;
                 }
+                anyPush = anyPush || neighborAbility->has(components::AbilityType::Push);
             }
+            pushing = anyPush && m_level->getSummary(next).pushables > 0;
+            cell = next;
         }
 
-        if (canMove)
-        {
-            if (m_level->isValid(proposed))
+        //
+        // Everything can move, aggregate the moves, then they'll be committed at a later time
+        m_moves[entity->getId()] = { entity, proposed };
+        pushing = ability->has(components::AbilityType::Push) && m_level->getSummary(proposed).pushables > 0;
+        cell = proposed;
+        while (pushing)
+        {
+            auto next = transformBySend(misc::HexCoord::getNextCell(cell, direction), direction);
+            bool anyPush{ false };
+            for (auto&& neighbor : m_level->getEntities(cell) | std::views::values | std::views::filter(isPushable))
             {
-                // Aggregate the moves, then they'll be committed at a later time
-                m_moves[entity->getId()] = { entity, proposed };
-
-                // We only want to play audio for one of the entities, rather than all of them
-                if (!m_audioPlayed && entity->hasComponent<components::Audio>())
-                {
-                    Audio::play(entity->getComponent<components::Audio>()->getKey());
-                    m_audioPlayed = true;
-                }
-
-                moved = true;
+                m_moves[neighbor->getId()] = { neighbor, next };
+                anyPush = anyPush || neighbor->getComponent<components::Ability>()->has(components::AbilityType::Push);
             }
+            pushing = anyPush && m_level->getSummary(next).pushables > 0;
+            cell = next;
         }
 
-        return moved;
+        // We only want to play audio for one of the entities, rather than all of them
+        if (!m_audioPlayed && entity->hasComponent<components::Audio>())
+        {
+            Audio::play(entity->getComponent<components::Audio>()->getSoundId(), 100.0f, Audio::Priority::Low);
+            m_audioPlayed = true;
+        }
+
+        return true;
     }
 
     // --------------------------------------------------------------
     //
-    //
+    // Starting at the position behind the entity that moved, pull the
+    // pullable entities along behind it.  For as long as a cell has
+    // something in it with the pull ability, keep going back another
+    // cell.
     //
     // --------------------------------------------------------------
     void Movement::pull(misc::HexCoord position, misc::HexCoord::Direction toDirection, misc::HexCoord::Direction fromDirection)
@@ -574,63 +607,46 @@ namespace systems
 
             return interested;
         };
-        static const auto isSteep = [](entities::EntityPtr entity)
-        {
-            return entity->hasComponent<components::Property>() &&
-                   entity->getComponent<components::Property>()->has(components::PropertyType::Steep);
-        };
-
-        // Base case: If the position is outside the grid, we are done
-        if (!position.isValid(m_level->getWidth(), m_level->getHeight()))
-        {
-            return;
-        }
+        // A chain that loops back on itself through send entities has to stop somewhere
+        const auto maxSteps = static_cast<std::size_t>(m_level->getWidth()) * static_cast<std::size_t>(m_level->getHeight());
 
-        // Get all the entities in this cell and see if they are pullable.
-        // If they are pullable, then move them.
-        // This has to be performed in two steps, because you can't iterate over the entities
-        // in a cell while also modifying that collection.
-        entities::EntityVector pullThese;
-        entities::EntityPtr canPull{ nullptr };
-        for (auto&& entity : m_level->getEntities(position) | std::views::values | std::views::filter(isType))
+        // If the position is outside the grid, or nothing there can be pulled, we are done
+        for (std::size_t step = 0; step < maxSteps && position.isValid(m_level->getWidth(), m_level->getHeight()); step++)
         {
-            // If the next cell has a "steep" entity and this entity doesn't have "climb" it can't be pulled
-            auto nextPosition = misc::HexCoord::getNextCell(position, toDirection);
-            auto anySteep = std::ranges::any_of(m_level->getEntities(nextPosition) | std::views::values, isSteep);
-            if (anySteep && entity->getComponent<components::Ability>()->has(components::AbilityType::Climb))
+            if (!m_level->getSummary(position).has(components::PropertyType::Pullable))
             {
-                pullThese.push_back(entity);
+                return;
             }
-            else if (!anySteep) // I know I could combine the logic above, but this makes it more clear for later on when I have to read the logic again
+
+            // If the next cell has a "steep" entity, only entities that can "climb" can be pulled
+            auto anySteep = m_level->getSummary(misc::HexCoord::getNextCell(position, toDirection)).has(components::PropertyType::Steep);
+            auto nextCell = transformBySend(misc::HexCoord::getNextCell(position, toDirection), toDirection);
+
+            bool canPull{ false };
+            for (auto&& entity : m_level->getEntities(position) | std::views::values | std::views::filter(isType))
             {
-                pullThese.push_back(entity);
+                if (!anySteep || entity->getComponent<components::Ability>()->has(components::AbilityType::Climb))
+                {
+                    m_pulls[entity] = nextCell;
+
+                    // Need to send notification of the pull
+                    m_notifyUpdated(entity->getId());
+                }
+                // As long as we get one, it doesn't matter which one
+                if (entity->hasComponent<components::Ability>() && entity->getComponent<components::Ability>()->has(components::AbilityType::Pull))
+                {
+                    canPull = true;
+                }
             }
-            // As long as we get one, it doesn't matter which one
-            if (entity->hasComponent<components::Ability>() && entity->getComponent<components::Ability>()->has(components::AbilityType::Pull))
+
+            //
+            // If any entity in this cell has the pull ability (detected above), then go ahead and
+            // pull more entities from the cell behind this one.
+            if (!canPull)
             {
-                canPull = entity;
+                return;
             }
-        }
-
-        //
-        // If any entity in this cell has the pull ability (detected above), then go ahead and recursively
-        // pull more entities.
-        if (canPull)
-        {
-            auto nextCell = misc::HexCoord::getNextCell(position, fromDirection);
-            nextCell = transformBySend(nextCell, fromDirection);
-            pull(nextCell, toDirection, fromDirection);
-        }
-
-        // Commit any pulls
-        for (auto&& entity : pullThese)
-        {
-            auto nextCell = misc::HexCoord::getNextCell(position, toDirection);
-            nextCell = transformBySend(nextCell, toDirection);
-            m_pulls[entity] = nextCell;
-
-            // Need to send notification of the pull
-            m_notifyUpdated(entity->getId());
+            position = transformBySend(misc::HexCoord::getNextCell(position, fromDirection), fromDirection);
         }
     }
 
@@ -642,19 +658,19 @@ namespace systems
     // --------------------------------------------------------------
     misc::HexCoord Movement::transformBySend(misc::HexCoord position, const misc::HexCoord::Direction& direction)
     {
-        auto itr = m_sendByPosition.find(position);
-        if (itr != m_sendByPosition.end())
+        auto itr = findSendPortal(position);
+        if (itr != m_sendPortals.end() && itr->position == position)
         {
-            // The iterator is with respect to the send entity we are on, therefore,
-            // we increment this pointer to go to the "next" send entity, if it exists.
+            // The next send entity is the one after this one in the ordering, wrapping around
+            // to the first one when at the end.
             ++itr;
-            if (itr != m_sendByPosition.end())
+            if (itr != m_sendPortals.end())
             {
-                position = itr->first;
+                position = itr->position;
             }
             else
             {
-                position = m_sendByPosition.begin()->first;
+                position = m_sendPortals.front().position;
             }
             // Then, we move the entity one more position, so it doesn't land on the send position, but one more position past it
             position = misc::HexCoord::getNextCell(position, direction);
@@ -24,6 +24,7 @@ THE SOFTWARE.
 
 #include "Level.hpp"
 #include "System.hpp"
+#include "components/Ability.hpp"
 
 #include <chrono>
 #include <functional>
@@ -49,6 +50,13 @@ namespace systems
         void update(std::chrono::microseconds elapsedTime) override;
         void shutdown() override;
 
+        // Used to inject a move that didn't come from the input devices (e.g., replays)
+        void signalMove(misc::HexCoord::Direction direction, bool withPull)
+        {
+            m_inputDirection = direction;
+            m_withPull = withPull;
+        }
+
       private:
         struct Move
         {
@@ -73,15 +81,28 @@ namespace systems
         bool m_audioPlayed{ false };
         std::unordered_map<entities::Entity::IdType, Move> m_moves;
         std::unordered_map<entities::EntityPtr, misc::HexCoord> m_pulls;
-        std::unordered_map<misc::HexCoord, entities::EntityPtr> m_sendByPosition;
+        // The send entities, ordered by row then column, the "next" send entity is the one that
+        // follows in this order (wrapping around).  Only one send entity per cell is used.
+        struct SendPortal
+        {
+            misc::HexCoord position;
+            entities::EntityPtr entity;
+        };
+        std::vector<SendPortal> m_sendPortals;
+        // Only used to tell which entities are send entities, the portals above keep them in order
+        Query m_senders{ Query().with(components::AbilityType::Send) };
 
         void registerKeyboardInput();
         void registerControllerInput();
         std::optional<misc::HexCoord::Direction> computeControllerDirection();
 
         void performMove(entities::EntityMap& entities);
+        bool canEnter(components::Ability* ability, const misc::HexCoord& cell);
         bool move(entities::EntityPtr entity, misc::HexCoord::Direction direction);
         void pull(misc::HexCoord position, misc::HexCoord::Direction toDirection, misc::HexCoord::Direction fromDirection);
         misc::HexCoord transformBySend(misc::HexCoord position, const misc::HexCoord::Direction& direction);
+        void addSendPortal(entities::EntityPtr entity);
+        void removeSendPortal(entities::Entity::IdType entityId);
+        std::vector<SendPortal>::iterator findSendPortal(const misc::HexCoord& position);
     };
 } // namespace systems
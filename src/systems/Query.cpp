@@ -0,0 +1,129 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Query.hpp"
+
+#include <algorithm>
+
+namespace systems
+{
+    Query& Query::with(components::PropertyType property)
+    {
+        with<components::Property>();
+        m_properties.push_back(property);
+        return *this;
+    }
+
+    Query& Query::with(components::AbilityType ability)
+    {
+        with<components::Ability>();
+        m_abilities.push_back(ability);
+        return *this;
+    }
+
+    Query& Query::with(components::ObjectType type)
+    {
+        with<components::Object>();
+        m_type = type;
+        return *this;
+    }
+
+    bool Query::matches(const entities::EntityPtr& entity) const
+    {
+        auto& components = entity->getComponents();
+
+        return std::ranges::all_of(m_with, [&components](auto id)
+                                   {
+                                       return components.contains(id);
+                                   }) &&
+               std::ranges::none_of(m_without, [&components](auto id)
+                                    {
+                                        return components.contains(id);
+                                    }) &&
+               std::ranges::all_of(m_properties, [&entity](auto property)
+                                   {
+                                       return entity->getComponent<components::Property>()->has(property);
+                                   }) &&
+               std::ranges::all_of(m_abilities, [&entity](auto ability)
+                                   {
+                                       return entity->getComponent<components::Ability>()->has(ability);
+                                   }) &&
+               (!m_type.has_value() || entity->getComponent<components::Object>()->getType() == m_type.value());
+    }
+
+    void Query::add(const entities::EntityPtr& entity)
+    {
+        if (!contains(entity->getId()) && matches(entity))
+        {
+            m_index[entity->getId()] = m_matches.size();
+            m_matches.push_back(entity);
+        }
+    }
+
+    // --------------------------------------------------------------
+    //
+    // The last match is moved into the hole, keeping the list dense.
+    //
+    // --------------------------------------------------------------
+    void Query::remove(entities::Entity::IdType entityId)
+    {
+        if (auto itr = m_index.find(entityId); itr != m_index.end())
+        {
+            auto index = itr->second;
+            m_index.erase(itr);
+            if (index != m_matches.size() - 1)
+            {
+                m_matches[index] = m_matches.back();
+                m_index[m_matches[index]->getId()] = index;
+            }
+            m_matches.pop_back();
+        }
+    }
+
+    // --------------------------------------------------------------
+    //
+    // An update can also replace the entity behind an id, so the stored
+    // entity is refreshed when it still matches.
+    //
+    // --------------------------------------------------------------
+    void Query::update(const entities::EntityPtr& entity)
+    {
+        if (!matches(entity))
+        {
+            remove(entity->getId());
+        }
+        else if (auto itr = m_index.find(entity->getId()); itr != m_index.end())
+        {
+            m_matches[itr->second] = entity;
+        }
+        else
+        {
+            add(entity);
+        }
+    }
+
+    void Query::clear()
+    {
+        m_matches.clear();
+        m_index.clear();
+    }
+} // namespace systems
@@ -0,0 +1,91 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "components/Ability.hpp"
+#include "components/Object.hpp"
+#include "components/Property.hpp"
+#include "entities/Entity.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace systems
+{
+    // --------------------------------------------------------------
+    //
+    // A query is a standing question a system asks about the entities.
+    // It is declared once, as the components an entity must (or must
+    // not) have, along with any Property, Ability, or Object type values
+    // the entity must have.  The owning system keeps the matching
+    // entities up to date as entities are added, removed, and updated,
+    // so each tick only walks a dense list of the matches.
+    //
+    // --------------------------------------------------------------
+    class Query
+    {
+      public:
+        template <typename T>
+        Query& with()
+        {
+            m_with.push_back(ctti::unnamed_type_id<T>());
+            return *this;
+        }
+
+        template <typename T>
+        Query& without()
+        {
+            m_without.push_back(ctti::unnamed_type_id<T>());
+            return *this;
+        }
+
+        Query& with(components::PropertyType property);
+        Query& with(components::AbilityType ability);
+        Query& with(components::ObjectType type);
+
+        bool matches(const entities::EntityPtr& entity) const;
+        bool contains(entities::Entity::IdType entityId) const { return m_index.contains(entityId); }
+
+        void add(const entities::EntityPtr& entity);
+        void remove(entities::Entity::IdType entityId);
+        void update(const entities::EntityPtr& entity);
+        void clear();
+
+        auto begin() const { return m_matches.begin(); }
+        auto end() const { return m_matches.end(); }
+        auto size() const { return m_matches.size(); }
+        bool empty() const { return m_matches.empty(); }
+
+      private:
+        std::vector<ctti::unnamed_type_id_t> m_with;
+        std::vector<ctti::unnamed_type_id_t> m_without;
+        std::vector<components::PropertyType> m_properties;
+        std::vector<components::AbilityType> m_abilities;
+        std::optional<components::ObjectType> m_type;
+
+        entities::EntityVector m_matches;
+        std::unordered_map<entities::Entity::IdType, std::size_t> m_index;
+    };
+} // namespace systems
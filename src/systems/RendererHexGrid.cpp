@@ -30,60 +30,67 @@ THE SOFTWARE.
 
 namespace systems
 {
-
-    RendererHexGrid::RendererHexGrid(const std::initializer_list<ctti::unnamed_type_id_t>& list, std::shared_ptr<Level> level) :
-        System(list),
-        m_level(level)
+    void VisibleCells::update(const entities::EntityPtr& camera)
     {
-    }
-
-    void RendererHexGrid::update([[maybe_unused]] const std::chrono::microseconds elapsedTime, sf::RenderTarget& renderTarget, const entities::EntityPtr& camera)
-    {
-        auto details = misc::computeRenderingDetails(camera, m_level->getWidth(), m_level->getHeight());
         auto compCamera = camera->getComponent<components::Camera>();
-
-        if (details.startR != m_previousStartR || details.startQ != m_previousStartQ || details.endR != m_previousEndR || details.endQ != m_previousEndQ || details.numberR != m_previousNumberR || details.numberQ != m_previousNumberQ || m_previousCenter != compCamera->getCenter())
+        auto coords = Configuration::getGraphics().getViewCoordinates();
+
+        bool cameraChange = m_cameraGeneration == 0 ||
+                            compCamera->getCenter() != m_previousCenter ||
+                            compCamera->getRange() != m_previousRange ||
+                            coords.width != m_previousCoords.width ||
+                            coords.height != m_previousCoords.height;
+        if (cameraChange)
         {
-            m_cameraChange = true;
-            m_previousStartR = details.startR;
-            m_previousStartQ = details.startQ;
-            m_previousEndR = details.endR;
-            m_previousEndQ = details.endQ;
-            m_previousNumberR = details.numberR;
-            m_previousNumberQ = details.numberQ;
+            m_cameraGeneration++;
             m_previousCenter = compCamera->getCenter();
-        }
-        else
-        {
-            m_cameraChange = false;
-        }
-
-        // Call into the derived class so it can do something for this update call
-        initUpdate(elapsedTime, details.startR, details.endR, details.startQ, details.endQ, details.numberR, details.numberQ, details.coords);
-
-        //
-        // Remember: 0, 0 is at the center of the window
-        // The - 0.5 * delta[XY] is to get the upper left location for the hex cell rendering
-        for (auto r = details.startR; r <= details.endR; r++)
-        {
-            float posY = details.startY + ((r - details.startR) - details.numberR / 2) * details.hexDimY - 0.5f * details.hexDimY;
-
-            for (auto q = details.startQ; q <= details.endQ; q++)
+            m_previousRange = compCamera->getRange();
+            m_previousCoords = coords;
+
+            m_details = misc::computeRenderingDetails(camera, m_level->getWidth(), m_level->getHeight());
+            m_rows.clear();
+            //
+            // Remember: 0, 0 is at the center of the window
+            // The - 0.5 * delta[XY] is to get the upper left location for the hex cell rendering
+            for (auto r = m_details.startR; r <= m_details.endR; r++)
             {
-                float posX = details.startX + ((q - details.startQ) - details.numberQ / 2) * details.hexDimX - 0.5f * details.hexDimX;
+                float posY = m_details.startY + ((r - m_details.startR) - m_details.numberR / 2) * m_details.hexDimY - 0.5f * m_details.hexDimY;
+                float posX = m_details.startX - (m_details.numberQ / 2) * m_details.hexDimX - 0.5f * m_details.hexDimX;
                 // Every other row adds 1/2 the width of the hex in order to correctly place the hex
                 if (r % 2 == 1)
                 {
-                    posX += details.hexDimX / 2.0f;
+                    posX += m_details.hexDimX / 2.0f;
                 }
 
-                // Call into the derived class so it can do something for this cell
-                perCell(renderTarget, { static_cast<misc::HexCoord::Type>(q), static_cast<misc::HexCoord::Type>(r) }, posX, posY, details.renderDimX, details.renderDimY);
+                misc::HexCoord first{ static_cast<misc::HexCoord::Type>(m_details.startQ), static_cast<misc::HexCoord::Type>(r) };
+                auto index = m_level->toOccupancyIndex(first);
+                m_rows.push_back({ first.r, index, index + (m_details.endQ - m_details.startQ) + 1, posX, posY });
             }
         }
+    }
+
+    RendererHexGrid::RendererHexGrid(const std::initializer_list<ctti::unnamed_type_id_t>& list, std::shared_ptr<Level> level) :
+        System(list),
+        m_level(level)
+    {
+    }
+
+    void RendererHexGrid::prepare(const std::chrono::microseconds elapsedTime, const VisibleCells& visible)
+    {
+        const auto& details = visible.getDetails();
+
+        m_cameraChange = visible.getCameraGeneration() != m_cameraGeneration;
+        m_cameraGeneration = visible.getCameraGeneration();
+
+        // Call into the derived class so it can do something for this update call
+        initUpdate(elapsedTime, details.startR, details.endR, details.startQ, details.endQ, details.numberR, details.numberQ, details.coords);
 
-        // Call into the derived class to let it do any work it wants to at the end of the update
-        finalizeUpdate(renderTarget);
+        visible.forEach(m_level->getOccupancy(getCellsOfInterest()),
+                        [this, &details](misc::HexCoord cell, float posX, float posY)
+                        {
+                            // Call into the derived class so it can do something for this cell
+                            perCell(cell, posX, posY, details.renderDimX, details.renderDimY);
+                        });
     }
 
-} // namespace systems
\ No newline at end of file
+} // namespace systems
@@ -24,39 +24,116 @@ THE SOFTWARE.
 
 #include "Level.hpp"
 #include "System.hpp"
+#include "misc/HexCoord.hpp"
 #include "misc/math.hpp"
 
 #include <SFML/Graphics.hpp>
 #include <cstdint>
+#include <vector>
 
 namespace systems
 {
+    // --------------------------------------------------------------
+    //
+    // The hex cells in view of the camera, along with where they are
+    // placed on the screen.  This is computed once per frame and shared
+    // by all of the hex grid renderers, and only recomputed when the
+    // camera (or view) changes.  Each visible row is kept as a span of
+    // occupancy bitmap indices along with its screen position, so the
+    // cells of interest in a row are found by iterating the set bits of
+    // a level occupancy bitmap over that span.
+    //
+    // --------------------------------------------------------------
+    class VisibleCells
+    {
+      public:
+        VisibleCells(std::shared_ptr<Level> level) :
+            m_level(level)
+        {
+        }
+
+        void update(const entities::EntityPtr& camera);
+
+        const misc::RenderingDetails& getDetails() const { return m_details; }
+        // Changes every time the cells in view, or their positions, change
+        auto getCameraGeneration() const { return m_cameraGeneration; }
+
+        // Calls the function with the coordinate and upper left screen position of each visible cell set in the bitmap
+        template <typename F>
+        void forEach(const misc::Bitset& occupancy, F&& function) const
+        {
+            for (auto&& row : m_rows)
+            {
+                occupancy.forEach(row.first, row.last, [&](std::size_t index)
+                                  {
+                                      auto q = static_cast<misc::HexCoord::Type>(m_details.startQ + (index - row.first));
+                                      function(misc::HexCoord{ q, row.r }, row.posX + (index - row.first) * m_details.hexDimX, row.posY);
+                                  });
+            }
+        }
+
+      private:
+        struct Row
+        {
+            misc::HexCoord::Type r;
+            std::size_t first; // occupancy index of the first visible cell in the row
+            std::size_t last;  // one past the last visible cell
+            float posX;        // screen position of the first visible cell
+            float posY;
+        };
+
+        std::shared_ptr<Level> m_level;
+        misc::RenderingDetails m_details;
+        std::vector<Row> m_rows;
+
+        std::uint32_t m_cameraGeneration{ 0 };
+        misc::HexCoord m_previousCenter{ 0, 0 };
+        std::uint8_t m_previousRange{ 0 };
+        math::Dimension2f m_previousCoords{};
+    };
+
+    // --------------------------------------------------------------
+    //
+    // Base for the systems that render something in every visible hex
+    // cell.  Rendering is split into two steps...
+    //   prepare: Walks the visible cells and builds the vertices to draw
+    //            from the level state.  Runs on a worker thread.  Only the
+    //            cells in the derived class' occupancy category are visited.
+    //   render:  Draws the most recently published vertices.  Runs on
+    //            the render (main) thread.
+    // Each derived class keeps two copies of whatever it prepares, the
+    // back one is filled by prepare while the front one is drawn by
+    // render, publish swaps them.  The game model prepares a snapshot at
+    // the end of every update and publishes it before drawing, so a frame
+    // never mixes the state of two ticks.
+    //
+    // --------------------------------------------------------------
     class RendererHexGrid : public System
     {
       public:
         RendererHexGrid(const std::initializer_list<ctti::unnamed_type_id_t>& list, std::shared_ptr<Level> level);
 
-        virtual void update(std::chrono::microseconds elapsedTime, sf::RenderTarget& renderTarget, const entities::EntityPtr& camera);
+        virtual void prepare(std::chrono::microseconds elapsedTime, const VisibleCells& visible);
+        virtual void render([[maybe_unused]] sf::RenderTarget& renderTarget){};
+        void publish() { m_back ^= 1; }
 
       protected:
         std::shared_ptr<Level> m_level;
 
         virtual void initUpdate([[maybe_unused]] std::chrono::microseconds elapsedTime, [[maybe_unused]] std::uint16_t startR, [[maybe_unused]] std::uint16_t endR, [[maybe_unused]] std::uint16_t startQ, [[maybe_unused]] std::uint16_t endQ, [[maybe_unused]] std::uint16_t numberR, [[maybe_unused]] std::uint16_t numberQ, [[maybe_unused]] const math::Dimension2f& coords){};
-        virtual void perCell(sf::RenderTarget& renderTarget, misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY) = 0;
-        virtual void finalizeUpdate([[maybe_unused]] sf::RenderTarget& renderTarget){};
+        virtual void perCell(misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY) = 0;
 
+        virtual Level::Occupancy getCellsOfInterest() const { return Level::Occupancy::Any; }
         bool didCameraChange() { return m_cameraChange; }
+        // Index of the copy filled by prepare and of the copy drawn by render
+        std::uint8_t back() const { return m_back; }
+        std::uint8_t front() const { return m_back ^ 1; }
 
       private:
         using System::update; // disables compiler warning from clang
 
+        std::uint8_t m_back{ 0 };
         bool m_cameraChange{ true };
-        std::uint16_t m_previousStartR{ 0 };
-        std::uint16_t m_previousStartQ{ 0 };
-        std::uint16_t m_previousEndR{ 0 };
-        std::uint16_t m_previousEndQ{ 0 };
-        std::uint16_t m_previousNumberR{ 0 };
-        std::uint16_t m_previousNumberQ{ 0 };
-        misc::HexCoord m_previousCenter{ 0, 0 };
+        std::uint32_t m_cameraGeneration{ 0 };
     };
 } // namespace systems
@@ -37,7 +37,10 @@ namespace systems
         // Prepare the various buffers for rendering
         for (std::uint8_t type = 0; type < m_buffer.size(); type++)
         {
-            m_cells[type].resize(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4);
+            for (auto&& frame : m_frames)
+            {
+                frame.cells[type].resize(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4);
+            }
             m_buffer[type].create(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4);
             m_buffer[type].setPrimitiveType(sf::PrimitiveType::Quads);
             m_buffer[type].setUsage(sf::VertexBuffer::Usage::Dynamic);
@@ -88,14 +91,18 @@ namespace systems
 
     void RendererHexGridAnimatedSprites::initUpdate([[maybe_unused]] std::chrono::microseconds elapsedTime, [[maybe_unused]] std::uint16_t startR, [[maybe_unused]] std::uint16_t endR, [[maybe_unused]] std::uint16_t startQ, [[maybe_unused]] std::uint16_t endQ, [[maybe_unused]] std::uint16_t numberR, [[maybe_unused]] std::uint16_t numberQ, [[maybe_unused]] const math::Dimension2f& coords)
     {
-        for (auto&& howManyToDraw : m_howManyToDraw)
+        auto& frame = m_frames[back()];
+        for (auto&& howManyToDraw : frame.howManyToDraw)
         {
             howManyToDraw = 0;
         }
+        // Textures can be changed as entities are updated, so the frame keeps the ones it was prepared with
+        frame.texture = m_texture;
     }
 
-    void RendererHexGridAnimatedSprites::perCell([[maybe_unused]] sf::RenderTarget& renderTarget, misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY)
+    void RendererHexGridAnimatedSprites::perCell(misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY)
     {
+        auto& frame = m_frames[back()];
         for (auto&& [order, entity] : m_level->getEntitiesByRender(cell))
         {
             if (entity->hasComponent<components::AnimatedSprite>())
@@ -111,18 +118,18 @@ namespace systems
                     }
                 }
 
-                auto vertex = m_howManyToDraw[bufferIndex];
+                auto vertex = frame.howManyToDraw[bufferIndex];
 
-                m_cells[bufferIndex][vertex + 0].position = sf::Vector2f(posX, posY);
-                m_cells[bufferIndex][vertex + 1].position = sf::Vector2f(posX + renderDimX, posY);
-                m_cells[bufferIndex][vertex + 2].position = sf::Vector2f(posX + renderDimX, posY + renderDimY);
-                m_cells[bufferIndex][vertex + 3].position = sf::Vector2f(posX, posY + renderDimY);
+                frame.cells[bufferIndex][vertex + 0].position = sf::Vector2f(posX, posY);
+                frame.cells[bufferIndex][vertex + 1].position = sf::Vector2f(posX + renderDimX, posY);
+                frame.cells[bufferIndex][vertex + 2].position = sf::Vector2f(posX + renderDimX, posY + renderDimY);
+                frame.cells[bufferIndex][vertex + 3].position = sf::Vector2f(posX, posY + renderDimY);
 
                 auto textureRect = entity->getComponent<components::AnimatedSprite>()->getCurrentSpriteRect();
-                m_cells[bufferIndex][vertex + 0].texCoords = sf::Vector2f(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top));
-                m_cells[bufferIndex][vertex + 1].texCoords = sf::Vector2f(static_cast<float>(textureRect.left + textureRect.width), static_cast<float>(textureRect.top));
-                m_cells[bufferIndex][vertex + 2].texCoords = sf::Vector2f(static_cast<float>(textureRect.left + textureRect.width), static_cast<float>(textureRect.top + textureRect.height));
-                m_cells[bufferIndex][vertex + 3].texCoords = sf::Vector2f(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top + textureRect.height));
+                frame.cells[bufferIndex][vertex + 0].texCoords = sf::Vector2f(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top));
+                frame.cells[bufferIndex][vertex + 1].texCoords = sf::Vector2f(static_cast<float>(textureRect.left + textureRect.width), static_cast<float>(textureRect.top));
+                frame.cells[bufferIndex][vertex + 2].texCoords = sf::Vector2f(static_cast<float>(textureRect.left + textureRect.width), static_cast<float>(textureRect.top + textureRect.height));
+                frame.cells[bufferIndex][vertex + 3].texCoords = sf::Vector2f(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top + textureRect.height));
 
                 // For text types, determine the complimentary color based on the background entity
                 auto color = sprite->getSpriteColor();
@@ -131,28 +138,29 @@ namespace systems
                     color = lookupComplementaryColor(cell);
                 }
 
-                m_cells[bufferIndex][vertex + 0].color = color;
-                m_cells[bufferIndex][vertex + 1].color = color;
-                m_cells[bufferIndex][vertex + 2].color = color;
-                m_cells[bufferIndex][vertex + 3].color = color;
+                frame.cells[bufferIndex][vertex + 0].color = color;
+                frame.cells[bufferIndex][vertex + 1].color = color;
+                frame.cells[bufferIndex][vertex + 2].color = color;
+                frame.cells[bufferIndex][vertex + 3].color = color;
 
-                m_howManyToDraw[bufferIndex] += 4;
+                frame.howManyToDraw[bufferIndex] += 4;
             }
         }
     }
 
-    void RendererHexGridAnimatedSprites::finalizeUpdate(sf::RenderTarget& renderTarget)
+    void RendererHexGridAnimatedSprites::render(sf::RenderTarget& renderTarget)
     {
+        auto& frame = m_frames[front()];
         for (std::uint8_t type = 0; type < m_buffer.size(); type++)
         {
             // Don't waste any time drawing nothing...this improved the
             // in-puzzle rendering by 25% to 30%
-            if (m_howManyToDraw[type] > 0)
+            if (frame.howManyToDraw[type] > 0)
             {
-                m_states[type].texture = m_texture[type];
-                m_buffer[type].update(m_cells[type].data());
+                m_states[type].texture = frame.texture[type];
+                m_buffer[type].update(frame.cells[type].data());
 
-                renderTarget.draw(m_buffer[type], 0, m_howManyToDraw[type], m_states[type]);
+                renderTarget.draw(m_buffer[type], 0, frame.howManyToDraw[type], m_states[type]);
             }
         }
     }
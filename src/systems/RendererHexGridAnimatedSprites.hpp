@@ -47,19 +47,27 @@ namespace systems
 
         bool addEntity(entities::EntityPtr entity) override;
         void updatedEntity(entities::EntityPtr entity) override;
+        void render(sf::RenderTarget& renderTarget) override;
 
       protected:
+        Level::Occupancy getCellsOfInterest() const override { return Level::Occupancy::AnimatedSprite; }
         void initUpdate(std::chrono::microseconds elapsedTime, std::uint16_t startR, std::uint16_t endR, std::uint16_t startQ, std::uint16_t endQ, std::uint16_t numberR, std::uint16_t numberQ, const math::Dimension2f& coords) override;
-        void perCell(sf::RenderTarget& renderTarget, misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY) override;
-        void finalizeUpdate(sf::RenderTarget& renderTarget) override;
+        void perCell(misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY) override;
 
       private:
-        // One vertex buffer (and related) for each Object type, as they correspond to different textures
+        // What prepare builds for a frame, one set of vertices (and related) for each Object type,
+        // as they correspond to different textures
+        struct Frame
+        {
+            std::array<std::vector<sf::Vertex>, components::Object::TYPE_SIZE> cells;
+            std::array<std::size_t, components::Object::TYPE_SIZE> howManyToDraw{ 0 };
+            std::array<const sf::Texture*, components::Object::TYPE_SIZE> texture{ nullptr };
+        };
+
         // NOTE: Could consider putting all textures at the same rendering order into a single texture
         //       to reduce the number of collections and draw calls.
         std::array<sf::VertexBuffer, components::Object::TYPE_SIZE> m_buffer;
-        std::array<std::vector<sf::Vertex>, components::Object::TYPE_SIZE> m_cells;
-        std::array<std::size_t, components::Object::TYPE_SIZE> m_howManyToDraw{ 0 };
+        std::array<Frame, 2> m_frames;
         std::array<sf::RenderStates, components::Object::TYPE_SIZE> m_states;
         std::array<const sf::Texture*, components::Object::TYPE_SIZE> m_texture;
 
@@ -41,20 +41,34 @@ namespace systems
         m_textCoords = std::make_unique<ui::Text>(settings);
     }
 
-    void RendererHexGridCoords::update([[maybe_unused]] const std::chrono::microseconds elapsedTime, sf::RenderTarget& renderTarget, const entities::EntityPtr& camera)
+    void RendererHexGridCoords::prepare(const std::chrono::microseconds elapsedTime, const VisibleCells& visible)
     {
-        if (Configuration::get<bool>(config::DEVELOPER_HEX_COORDS_RENDER))
+        m_frames[back()].clear();
+        if (m_renderCoords.get())
         {
-            RendererHexGrid::update(elapsedTime, renderTarget, camera);
+            RendererHexGrid::prepare(elapsedTime, visible);
         }
     }
 
-    void RendererHexGridCoords::perCell(sf::RenderTarget& renderTarget, misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY)
+    void RendererHexGridCoords::render(sf::RenderTarget& renderTarget)
     {
-        m_textCoords->setText(std::format("{0},{1}", cell.q, cell.r));
-        // Center in the cell
-        m_textCoords->setPosition({ posX + renderDimX / 2 - m_textCoords->getRegion().width / 2.0f, posY + renderDimY / 2 - m_textCoords->getRegion().height / 2.0f });
-        m_textCoords->render(renderTarget);
+        for (auto&& label : m_frames[front()])
+        {
+            m_textCoords->setText(std::format("{0},{1}", label.cell.q, label.cell.r));
+            // Center in the cell
+            m_textCoords->setPosition({ label.center.x - m_textCoords->getRegion().width / 2.0f, label.center.y - m_textCoords->getRegion().height / 2.0f });
+            m_textCoords->render(renderTarget);
+        }
+    }
+
+    void RendererHexGridCoords::initUpdate([[maybe_unused]] std::chrono::microseconds elapsedTime, [[maybe_unused]] std::uint16_t startR, [[maybe_unused]] std::uint16_t endR, [[maybe_unused]] std::uint16_t startQ, [[maybe_unused]] std::uint16_t endQ, std::uint16_t numberR, std::uint16_t numberQ, [[maybe_unused]] const math::Dimension2f& coords)
+    {
+        m_frames[back()].reserve(static_cast<std::size_t>(numberR) * numberQ);
+    }
+
+    void RendererHexGridCoords::perCell(misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY)
+    {
+        m_frames[back()].push_back({ cell, { posX + renderDimX / 2, posY + renderDimY / 2 } });
     }
 
 } // namespace systems
\ No newline at end of file
@@ -24,6 +24,11 @@ THE SOFTWARE.
 
 #include "RendererHexGrid.hpp"
 #include "UIFramework/Text.hpp"
+#include "services/Configuration.hpp"
+#include "services/ConfigurationPath.hpp"
+
+#include <array>
+#include <vector>
 
 namespace systems
 {
@@ -32,13 +37,23 @@ namespace systems
       public:
         RendererHexGridCoords(std::shared_ptr<Level> level);
 
-        void update(std::chrono::microseconds elapsedTime, sf::RenderTarget& renderTarget, const entities::EntityPtr& camera) override;
+        void prepare(std::chrono::microseconds elapsedTime, const VisibleCells& visible) override;
+        void render(sf::RenderTarget& renderTarget) override;
 
       protected:
         bool isInterested([[maybe_unused]] const entities::EntityPtr& entity) override { return false; }
-        void perCell(sf::RenderTarget& renderTarget, misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY) override;
+        void initUpdate(std::chrono::microseconds elapsedTime, std::uint16_t startR, std::uint16_t endR, std::uint16_t startQ, std::uint16_t endQ, std::uint16_t numberR, std::uint16_t numberQ, const math::Dimension2f& coords) override;
+        void perCell(misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY) override;
 
       private:
+        struct Label
+        {
+            misc::HexCoord cell;
+            math::Point2f center;
+        };
+
         std::unique_ptr<ui::Text> m_textCoords;
+        std::array<std::vector<Label>, 2> m_frames;
+        Configuration::Value<bool> m_renderCoords{ config::DEVELOPER_HEX_COORDS_RENDER };
     };
 } // namespace systems
@@ -33,7 +33,7 @@ namespace systems
         RendererHexGridHighlight(level, addEntity)
     {
         // We make an entity that has the animated sprite that is rendered over every Property::Goal object.
-        m_highlight = std::make_shared<entities::Entity>();
+        m_highlight = entities::create();
         m_highlight->addComponent(entities::createAnimatedSprite(config::DOM_IMAGES_ANIMATED, "goal-highlight", content::KEY_IMAGE_GOAL_HIGHLIGHT));
         m_texture = m_highlight->getComponent<components::AnimatedSprite>()->getSprite()->getTexture();
 
@@ -54,7 +54,10 @@ namespace systems
         }
 
         // Prepare the various buffers for rendering
-        m_cells.resize(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4);
+        for (auto&& frame : m_frames)
+        {
+            frame.cells.resize(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4);
+        }
         m_buffer.create(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4);
         m_buffer.setPrimitiveType(sf::PrimitiveType::Quads);
         m_buffer.setUsage(sf::VertexBuffer::Usage::Dynamic);
@@ -138,43 +141,45 @@ namespace systems
 
     void RendererHexGridHighlight::initUpdate([[maybe_unused]] std::chrono::microseconds elapsedTime, [[maybe_unused]] std::uint16_t startR, [[maybe_unused]] std::uint16_t endR, [[maybe_unused]] std::uint16_t startQ, [[maybe_unused]] std::uint16_t endQ, [[maybe_unused]] std::uint16_t numberR, [[maybe_unused]] std::uint16_t numberQ, [[maybe_unused]] const math::Dimension2f& coords)
     {
-        m_howManyToDraw = 0;
+        m_frames[back()].howManyToDraw = 0;
     }
 
-    void RendererHexGridHighlight::perCell([[maybe_unused]] sf::RenderTarget& renderTarget, misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY)
+    void RendererHexGridHighlight::perCell(misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY)
     {
+        auto& frame = m_frames[back()];
         // See if we are tracking anyone in this cell
         if (m_gridTypeCount[cell.r][cell.q] > 0)
         {
             auto sprite = m_highlight->getComponent<components::AnimatedSprite>();
 
-            auto vertex = m_howManyToDraw;
+            auto vertex = frame.howManyToDraw;
 
-            m_cells[vertex + 0].position = sf::Vector2f(posX, posY);
-            m_cells[vertex + 1].position = sf::Vector2f(posX + renderDimX, posY);
-            m_cells[vertex + 2].position = sf::Vector2f(posX + renderDimX, posY + renderDimY);
-            m_cells[vertex + 3].position = sf::Vector2f(posX, posY + renderDimY);
+            frame.cells[vertex + 0].position = sf::Vector2f(posX, posY);
+            frame.cells[vertex + 1].position = sf::Vector2f(posX + renderDimX, posY);
+            frame.cells[vertex + 2].position = sf::Vector2f(posX + renderDimX, posY + renderDimY);
+            frame.cells[vertex + 3].position = sf::Vector2f(posX, posY + renderDimY);
 
             auto textureRect = m_highlight->getComponent<components::AnimatedSprite>()->getCurrentSpriteRect();
-            m_cells[vertex + 0].texCoords = sf::Vector2f(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top));
-            m_cells[vertex + 1].texCoords = sf::Vector2f(static_cast<float>(textureRect.left + textureRect.width), static_cast<float>(textureRect.top));
-            m_cells[vertex + 2].texCoords = sf::Vector2f(static_cast<float>(textureRect.left + textureRect.width), static_cast<float>(textureRect.top + textureRect.height));
-            m_cells[vertex + 3].texCoords = sf::Vector2f(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top + textureRect.height));
+            frame.cells[vertex + 0].texCoords = sf::Vector2f(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top));
+            frame.cells[vertex + 1].texCoords = sf::Vector2f(static_cast<float>(textureRect.left + textureRect.width), static_cast<float>(textureRect.top));
+            frame.cells[vertex + 2].texCoords = sf::Vector2f(static_cast<float>(textureRect.left + textureRect.width), static_cast<float>(textureRect.top + textureRect.height));
+            frame.cells[vertex + 3].texCoords = sf::Vector2f(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top + textureRect.height));
 
-            m_cells[vertex + 0].color = sprite->getSpriteColor();
-            m_cells[vertex + 1].color = sprite->getSpriteColor();
-            m_cells[vertex + 2].color = sprite->getSpriteColor();
-            m_cells[vertex + 3].color = sprite->getSpriteColor();
+            frame.cells[vertex + 0].color = sprite->getSpriteColor();
+            frame.cells[vertex + 1].color = sprite->getSpriteColor();
+            frame.cells[vertex + 2].color = sprite->getSpriteColor();
+            frame.cells[vertex + 3].color = sprite->getSpriteColor();
 
-            m_howManyToDraw += 4;
+            frame.howManyToDraw += 4;
         }
     }
 
-    void RendererHexGridHighlight::finalizeUpdate(sf::RenderTarget& renderTarget)
+    void RendererHexGridHighlight::render(sf::RenderTarget& renderTarget)
     {
+        auto& frame = m_frames[front()];
         m_state.texture = m_texture;
-        m_buffer.update(m_cells.data());
-        renderTarget.draw(m_buffer, 0, m_howManyToDraw, m_state);
+        m_buffer.update(frame.cells.data());
+        renderTarget.draw(m_buffer, 0, frame.howManyToDraw, m_state);
     }
 
 } // namespace systems
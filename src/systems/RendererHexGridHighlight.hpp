@@ -27,6 +27,7 @@ THE SOFTWARE.
 #include "entities/Entity.hpp"
 
 #include <SFML/Graphics.hpp>
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <unordered_map>
@@ -50,11 +51,11 @@ namespace systems
         bool addEntity(entities::EntityPtr entity) override;
         void removeEntity(entities::Entity::IdType entityId) override;
         void updatedEntity(entities::EntityPtr entity) override;
+        void render(sf::RenderTarget& renderTarget) override;
 
       protected:
         void initUpdate(std::chrono::microseconds elapsedTime, std::uint16_t startR, std::uint16_t endR, std::uint16_t startQ, std::uint16_t endQ, std::uint16_t numberR, std::uint16_t numberQ, const math::Dimension2f& coords) override;
-        void perCell(sf::RenderTarget& renderTarget, misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY) override;
-        void finalizeUpdate(sf::RenderTarget& renderTarget) override;
+        void perCell(misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY) override;
 
         std::function<void(entities::EntityPtr)> m_addEntity;
         entities::EntityPtr m_highlight;
@@ -64,9 +65,14 @@ namespace systems
         std::vector<std::vector<std::uint16_t>> m_gridTypeCount;
         std::unordered_map<entities::Entity::IdType, misc::HexCoord> m_idToCoord;
 
+        struct Frame
+        {
+            std::vector<sf::Vertex> cells;
+            std::size_t howManyToDraw{ 0 };
+        };
+
         sf::VertexBuffer m_buffer;
-        std::vector<sf::Vertex> m_cells;
-        std::size_t m_howManyToDraw{ 0 };
+        std::array<Frame, 2> m_frames;
         sf::RenderStates m_state;
     };
 } // namespace systems
@@ -33,7 +33,7 @@ namespace systems
         RendererHexGridHighlight(level, addEntity)
     {
         // We make an entity that has the animated sprite that is rendered over every Property::I object.
-        m_highlight = std::make_shared<entities::Entity>();
+        m_highlight = entities::create();
         m_highlight->addComponent(entities::createAnimatedSprite(config::DOM_IMAGES_ANIMATED, "i-am-highlight-512", content::KEY_IMAGE_I_AM_HIGHLIGHT_512));
         m_texture = m_highlight->getComponent<components::AnimatedSprite>()->getSprite()->getTexture();
 
@@ -38,5 +38,6 @@ namespace systems
 
       protected:
         bool isInterested(const entities::EntityPtr& entity) override;
+        Level::Occupancy getCellsOfInterest() const override { return Level::Occupancy::I; }
     };
 } // namespace systems
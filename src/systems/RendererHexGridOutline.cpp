@@ -34,12 +34,16 @@ namespace systems
         RendererHexGrid({ /* Doesn't specify any interest because it only cares about coordinates */ }, level)
     {
         m_texture = Content::instance().get<sf::Texture>(content::KEY_IMAGE_HEX_OUTLINE_256);
+        m_textureRect = Content::getTextureRect(content::KEY_IMAGE_HEX_OUTLINE_256);
         m_states.texture = &(*m_texture);
 
         m_color = Configuration::get<sf::Color>(config::IMAGE_HEX_OUTLINE_256_COLOR);
 
         // Size everything for the max possible number of items, but will only draw what is actually visible
-        m_cells.resize(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4);
+        for (auto&& frame : m_frames)
+        {
+            frame.cells.resize(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4);
+        }
         m_buffer.create(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4);
     }
 
@@ -47,44 +51,58 @@ namespace systems
     {
         if (didCameraChange())
         {
-            m_howManyToDraw = 0;
+            m_rebuildsNeeded = static_cast<std::uint8_t>(m_frames.size());
+        }
+
+        auto& frame = m_frames[back()];
+        frame.rebuilt = m_rebuildsNeeded > 0;
+        if (frame.rebuilt)
+        {
+            frame.howManyToDraw = 0;
+            m_rebuildsNeeded--;
         }
     }
 
-    void RendererHexGridOutline::perCell([[maybe_unused]] sf::RenderTarget& renderTarget, [[maybe_unused]] misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY)
+    void RendererHexGridOutline::perCell([[maybe_unused]] misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY)
     {
-        // If there are no entities at this location, we don't draw anything.  This allows for
-        // levels to have other than square shapes.
-        if (didCameraChange() && m_level->getEntities(cell).size() > 0)
+        auto& frame = m_frames[back()];
+        // Only occupied cells come through here, so nothing is drawn where there are no entities.  This
+        // allows for levels to have other than square shapes.
+        if (frame.rebuilt)
         {
-            auto index = m_howManyToDraw;
-            m_cells[index + 0].position = sf::Vector2f(posX, posY);
-            m_cells[index + 1].position = sf::Vector2f(posX + renderDimX, posY);
-            m_cells[index + 2].position = sf::Vector2f(posX + renderDimX, posY + renderDimY);
-            m_cells[index + 3].position = sf::Vector2f(posX, posY + renderDimY);
-
-            m_cells[index + 0].texCoords = sf::Vector2f(0, 0);
-            m_cells[index + 1].texCoords = sf::Vector2f(static_cast<float>(m_texture->getSize().x), 0);
-            m_cells[index + 2].texCoords = sf::Vector2f(static_cast<float>(m_texture->getSize().x), static_cast<float>(m_texture->getSize().y));
-            m_cells[index + 3].texCoords = sf::Vector2f(0, static_cast<float>(m_texture->getSize().y));
-
-            m_cells[index + 0].color = sf::Color(m_color);
-            m_cells[index + 1].color = sf::Color(m_color);
-            m_cells[index + 2].color = sf::Color(m_color);
-            m_cells[index + 3].color = sf::Color(m_color);
-
-            m_howManyToDraw += 4;
+            auto index = frame.howManyToDraw;
+            frame.cells[index + 0].position = sf::Vector2f(posX, posY);
+            frame.cells[index + 1].position = sf::Vector2f(posX + renderDimX, posY);
+            frame.cells[index + 2].position = sf::Vector2f(posX + renderDimX, posY + renderDimY);
+            frame.cells[index + 3].position = sf::Vector2f(posX, posY + renderDimY);
+
+            auto left = static_cast<float>(m_textureRect.left);
+            auto top = static_cast<float>(m_textureRect.top);
+            auto right = static_cast<float>(m_textureRect.left + m_textureRect.width);
+            auto bottom = static_cast<float>(m_textureRect.top + m_textureRect.height);
+            frame.cells[index + 0].texCoords = sf::Vector2f(left, top);
+            frame.cells[index + 1].texCoords = sf::Vector2f(right, top);
+            frame.cells[index + 2].texCoords = sf::Vector2f(right, bottom);
+            frame.cells[index + 3].texCoords = sf::Vector2f(left, bottom);
+
+            frame.cells[index + 0].color = sf::Color(m_color);
+            frame.cells[index + 1].color = sf::Color(m_color);
+            frame.cells[index + 2].color = sf::Color(m_color);
+            frame.cells[index + 3].color = sf::Color(m_color);
+
+            frame.howManyToDraw += 4;
         }
     }
 
-    void RendererHexGridOutline::finalizeUpdate(sf::RenderTarget& renderTarget)
+    void RendererHexGridOutline::render(sf::RenderTarget& renderTarget)
     {
+        auto& frame = m_frames[front()];
         // TODO: Only want to update if something about the visible cells has changed
-        if (didCameraChange())
+        if (frame.rebuilt)
         {
-            m_buffer.update(m_cells.data());
+            m_buffer.update(frame.cells.data());
         }
 
-        renderTarget.draw(m_buffer, 0, m_howManyToDraw, m_states);
+        renderTarget.draw(m_buffer, 0, frame.howManyToDraw, m_states);
     }
 } // namespace systems
\ No newline at end of file
@@ -25,6 +25,7 @@ THE SOFTWARE.
 #include "RendererHexGrid.hpp"
 
 #include <SFML/Graphics.hpp>
+#include <array>
 #include <vector>
 
 namespace systems
@@ -34,17 +35,26 @@ namespace systems
       public:
         RendererHexGridOutline(std::shared_ptr<Level> level);
 
+        void render(sf::RenderTarget& renderTarget) override;
+
       protected:
         void initUpdate(std::chrono::microseconds elapsedTime, std::uint16_t startR, std::uint16_t endR, std::uint16_t startQ, std::uint16_t endQ, std::uint16_t numberR, std::uint16_t numberQ, const math::Dimension2f& coords) override;
-        void perCell(sf::RenderTarget& renderTarget, misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY) override;
-        void finalizeUpdate(sf::RenderTarget& renderTarget) override;
+        void perCell(misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY) override;
 
       private:
+        struct Frame
+        {
+            std::vector<sf::Vertex> cells;
+            std::size_t howManyToDraw{ 0 };
+            bool rebuilt{ false };
+        };
+
         std::shared_ptr<sf::Texture> m_texture;
+        sf::IntRect m_textureRect; // Where the outline is in the texture, which may be an atlas page
         sf::Color m_color;
         sf::VertexBuffer m_buffer{ sf::PrimitiveType::Quads, sf::VertexBuffer::Usage::Dynamic };
-        std::vector<sf::Vertex> m_cells;
-        std::size_t m_howManyToDraw{ 0 };
+        std::array<Frame, 2> m_frames;
+        std::uint8_t m_rebuildsNeeded{ 0 }; // When the camera changes, both frames have to be rebuilt
         sf::RenderStates m_states;
     };
 } // namespace systems
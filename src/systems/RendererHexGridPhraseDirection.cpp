@@ -47,7 +47,10 @@ namespace systems
 
         // Size everything for the max possible number of items, but will only draw what is actually visible
         // Max items is 5 direction arrows in each cell and 4 verts per each arrow
-        m_cells.resize(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4 * 5);
+        for (auto&& frame : m_frames)
+        {
+            frame.cells.resize(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4 * 5);
+        }
         m_buffer.create(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4 * 5);
 
         m_directions.resize(level->getHeight());
@@ -155,13 +158,14 @@ namespace systems
 
     void RendererHexGridPhraseDirection::initUpdate([[maybe_unused]] std::chrono::microseconds elapsedTime, [[maybe_unused]] std::uint16_t startR, [[maybe_unused]] std::uint16_t endR, [[maybe_unused]] std::uint16_t startQ, [[maybe_unused]] std::uint16_t endQ, [[maybe_unused]] std::uint16_t numberR, [[maybe_unused]] std::uint16_t numberQ, [[maybe_unused]] const math::Dimension2f& coords)
     {
-        m_howManyToDraw = 0;
+        m_frames[back()].howManyToDraw = 0;
     }
 
-    void RendererHexGridPhraseDirection::perCell([[maybe_unused]] sf::RenderTarget& renderTarget, [[maybe_unused]] misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY)
+    void RendererHexGridPhraseDirection::perCell([[maybe_unused]] misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY)
     {
-        // The test using m_howManyToDraw prevents a crash in the case too many direction arrows are being attempted to render
-        if (m_howManyToDraw < m_cells.size() && (m_renderAllArrows || (m_mouseStartCell.has_value() && m_mouseHoverCells.contains(cell))))
+        auto& frame = m_frames[back()];
+        // The test using frame.howManyToDraw prevents a crash in the case too many direction arrows are being attempted to render
+        if (frame.howManyToDraw < frame.cells.size() && (m_renderAllArrows || (m_mouseStartCell.has_value() && m_mouseHoverCells.contains(cell))))
         {
             // Because phrases can have a lot of overlapping duplicates, this is used to very significantly reduce
             // drawing the same direction arrows over and over, as in 10X (or more!) reduction in some cases.
@@ -174,7 +178,7 @@ namespace systems
             {
                 if (!uniqueDirs[static_cast<std::uint8_t>(std::get<components::PhraseDirection::GridDirection>(data))])
                 {
-                    auto index = m_howManyToDraw;
+                    auto index = frame.howManyToDraw;
 
                     float posOffsetX{ 0 };
                     float posOffsetY{ 0 };
@@ -230,22 +234,22 @@ namespace systems
                             break;
                     }
 
-                    m_cells[index + 0].position = sf::Vector2f(posX + posOffsetX, posY + posOffsetY);
-                    m_cells[index + 1].position = sf::Vector2f(posX + renderDimX + posOffsetX, posY + posOffsetY);
-                    m_cells[index + 2].position = sf::Vector2f(posX + renderDimX + posOffsetX, posY + renderDimY + posOffsetY);
-                    m_cells[index + 3].position = sf::Vector2f(posX + posOffsetX, posY + renderDimY + posOffsetY);
+                    frame.cells[index + 0].position = sf::Vector2f(posX + posOffsetX, posY + posOffsetY);
+                    frame.cells[index + 1].position = sf::Vector2f(posX + renderDimX + posOffsetX, posY + posOffsetY);
+                    frame.cells[index + 2].position = sf::Vector2f(posX + renderDimX + posOffsetX, posY + renderDimY + posOffsetY);
+                    frame.cells[index + 3].position = sf::Vector2f(posX + posOffsetX, posY + renderDimY + posOffsetY);
 
-                    m_cells[index + 0].texCoords = sf::Vector2f(texStartX, texStartY);
-                    m_cells[index + 1].texCoords = sf::Vector2f(texEndX, texStartY);
-                    m_cells[index + 2].texCoords = sf::Vector2f(texEndX, texEndY);
-                    m_cells[index + 3].texCoords = sf::Vector2f(texStartX, texEndY);
+                    frame.cells[index + 0].texCoords = sf::Vector2f(texStartX, texStartY);
+                    frame.cells[index + 1].texCoords = sf::Vector2f(texEndX, texStartY);
+                    frame.cells[index + 2].texCoords = sf::Vector2f(texEndX, texEndY);
+                    frame.cells[index + 3].texCoords = sf::Vector2f(texStartX, texEndY);
 
-                    m_cells[index + 0].color = sf::Color(m_color);
-                    m_cells[index + 1].color = sf::Color(m_color);
-                    m_cells[index + 2].color = sf::Color(m_color);
-                    m_cells[index + 3].color = sf::Color(m_color);
+                    frame.cells[index + 0].color = sf::Color(m_color);
+                    frame.cells[index + 1].color = sf::Color(m_color);
+                    frame.cells[index + 2].color = sf::Color(m_color);
+                    frame.cells[index + 3].color = sf::Color(m_color);
 
-                    m_howManyToDraw += 4;
+                    frame.howManyToDraw += 4;
 
                     uniqueDirs[static_cast<std::uint8_t>(std::get<components::PhraseDirection::GridDirection>(data))] = true;
                 }
@@ -253,12 +257,14 @@ namespace systems
         }
     }
 
-    void RendererHexGridPhraseDirection::finalizeUpdate(sf::RenderTarget& renderTarget)
+    void RendererHexGridPhraseDirection::render(sf::RenderTarget& renderTarget)
     {
-        if (m_renderAllArrows || m_mouseStartCell.has_value())
+        // Nothing is prepared unless all arrows are shown, or the mouse is hovering over a phrase
+        auto& frame = m_frames[front()];
+        if (frame.howManyToDraw > 0)
         {
-            m_buffer.update(m_cells.data());
-            renderTarget.draw(m_buffer, 0, m_howManyToDraw, m_states);
+            m_buffer.update(frame.cells.data());
+            renderTarget.draw(m_buffer, 0, frame.howManyToDraw, m_states);
         }
     }
 
@@ -26,6 +26,7 @@ THE SOFTWARE.
 #include "systems/parser/PhraseSearch.hpp"
 
 #include <SFML/Graphics.hpp>
+#include <array>
 #include <cstdint>
 #include <optional>
 #include <unordered_set>
@@ -46,12 +47,13 @@ namespace systems
         bool addEntity(entities::EntityPtr entity) override;
         void removeEntity(entities::Entity::IdType entityId) override;
         void shutdown() override;
+        void render(sf::RenderTarget& renderTarget) override;
 
       protected:
         bool isInterested(const entities::EntityPtr& entity) override;
+        Level::Occupancy getCellsOfInterest() const override { return Level::Occupancy::Text; }
         void initUpdate(std::chrono::microseconds elapsedTime, std::uint16_t startR, std::uint16_t endR, std::uint16_t startQ, std::uint16_t endQ, std::uint16_t numberR, std::uint16_t numberQ, const math::Dimension2f& coords) override;
-        void perCell(sf::RenderTarget& renderTarget, misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY) override;
-        void finalizeUpdate(sf::RenderTarget& renderTarget) override;
+        void perCell(misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY) override;
 
       private:
         bool m_renderAllArrows{ false };
@@ -66,9 +68,14 @@ namespace systems
 
         std::shared_ptr<sf::Texture> m_texture;
         sf::Color m_color;
+        struct Frame
+        {
+            std::vector<sf::Vertex> cells;
+            std::size_t howManyToDraw{ 0 };
+        };
+
         sf::VertexBuffer m_buffer{ sf::PrimitiveType::Quads, sf::VertexBuffer::Usage::Dynamic };
-        std::vector<sf::Vertex> m_cells;
-        std::size_t m_howManyToDraw{ 0 };
+        std::array<Frame, 2> m_frames;
         sf::RenderStates m_states;
 
         void mouseMoved(math::Point2f point);
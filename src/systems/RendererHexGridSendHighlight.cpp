@@ -37,7 +37,7 @@ namespace systems
                                  level, addEntity)
     {
         // We make an entity that has the animated sprite that is rendered over every Ability::Send object.
-        m_highlight = std::make_shared<entities::Entity>();
+        m_highlight = entities::create();
         m_highlight->addComponent(entities::createAnimatedSprite(config::DOM_IMAGES_ANIMATED, "send-highlight", content::KEY_IMAGE_SEND_HIGHLIGHT));
         m_texture = m_highlight->getComponent<components::AnimatedSprite>()->getSprite()->getTexture();
 
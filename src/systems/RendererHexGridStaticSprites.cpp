@@ -36,7 +36,10 @@ namespace systems
         // Prepare the various buffers for rendering
         for (std::uint8_t type = 0; type < m_buffer.size(); type++)
         {
-            m_cells[type].resize(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4);
+            for (auto&& frame : m_frames)
+            {
+                frame.cells[type].resize(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4);
+            }
             m_buffer[type].create(static_cast<std::size_t>(level->getHeight()) * static_cast<std::size_t>(level->getWidth()) * 4);
             m_buffer[type].setPrimitiveType(sf::PrimitiveType::Quads);
             m_buffer[type].setUsage(sf::VertexBuffer::Usage::Dynamic);
@@ -75,14 +78,18 @@ namespace systems
 
     void RendererHexGridStaticSprites::initUpdate([[maybe_unused]] std::chrono::microseconds elapsedTime, [[maybe_unused]] std::uint16_t startR, [[maybe_unused]] std::uint16_t endR, [[maybe_unused]] std::uint16_t startQ, [[maybe_unused]] std::uint16_t endQ, [[maybe_unused]] std::uint16_t numberR, [[maybe_unused]] std::uint16_t numberQ, [[maybe_unused]] const math::Dimension2f& coords)
     {
-        for (auto&& howManyToDraw : m_howManyToDraw)
+        auto& frame = m_frames[back()];
+        for (auto&& howManyToDraw : frame.howManyToDraw)
         {
             howManyToDraw = 0;
         }
+        // Textures can be changed as entities are updated, so the frame keeps the ones it was prepared with
+        frame.texture = m_texture;
     }
 
-    void RendererHexGridStaticSprites::perCell([[maybe_unused]] sf::RenderTarget& renderTarget, misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY)
+    void RendererHexGridStaticSprites::perCell(misc::HexCoord cell, float posX, float posY, float renderDimX, float renderDimY)
     {
+        auto& frame = m_frames[back()];
         for (auto&& [order, entity] : m_level->getEntitiesByRender(cell))
         {
             if (entity->hasComponent<components::StaticSprite>())
@@ -90,37 +97,38 @@ namespace systems
                 auto sprite = entity->getComponent<components::StaticSprite>();
                 std::size_t bufferIndex = entity->getComponent<components::Object>()->renderSequence();
 
-                auto vertex = m_howManyToDraw[bufferIndex];
+                auto vertex = frame.howManyToDraw[bufferIndex];
 
-                m_cells[bufferIndex][vertex + 0].position = sf::Vector2f(posX, posY);
-                m_cells[bufferIndex][vertex + 1].position = sf::Vector2f(posX + renderDimX, posY);
-                m_cells[bufferIndex][vertex + 2].position = sf::Vector2f(posX + renderDimX, posY + renderDimY);
-                m_cells[bufferIndex][vertex + 3].position = sf::Vector2f(posX, posY + renderDimY);
+                frame.cells[bufferIndex][vertex + 0].position = sf::Vector2f(posX, posY);
+                frame.cells[bufferIndex][vertex + 1].position = sf::Vector2f(posX + renderDimX, posY);
+                frame.cells[bufferIndex][vertex + 2].position = sf::Vector2f(posX + renderDimX, posY + renderDimY);
+                frame.cells[bufferIndex][vertex + 3].position = sf::Vector2f(posX, posY + renderDimY);
 
                 auto textureRect = entity->getComponent<components::StaticSprite>()->getCurrentSpriteRect();
-                m_cells[bufferIndex][vertex + 0].texCoords = sf::Vector2f(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top));
-                m_cells[bufferIndex][vertex + 1].texCoords = sf::Vector2f(static_cast<float>(textureRect.left + textureRect.width), static_cast<float>(textureRect.top));
-                m_cells[bufferIndex][vertex + 2].texCoords = sf::Vector2f(static_cast<float>(textureRect.left + textureRect.width), static_cast<float>(textureRect.top + textureRect.height));
-                m_cells[bufferIndex][vertex + 3].texCoords = sf::Vector2f(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top + textureRect.height));
+                frame.cells[bufferIndex][vertex + 0].texCoords = sf::Vector2f(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top));
+                frame.cells[bufferIndex][vertex + 1].texCoords = sf::Vector2f(static_cast<float>(textureRect.left + textureRect.width), static_cast<float>(textureRect.top));
+                frame.cells[bufferIndex][vertex + 2].texCoords = sf::Vector2f(static_cast<float>(textureRect.left + textureRect.width), static_cast<float>(textureRect.top + textureRect.height));
+                frame.cells[bufferIndex][vertex + 3].texCoords = sf::Vector2f(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top + textureRect.height));
 
-                m_cells[bufferIndex][vertex + 0].color = sprite->getSpriteColor();
-                m_cells[bufferIndex][vertex + 1].color = sprite->getSpriteColor();
-                m_cells[bufferIndex][vertex + 2].color = sprite->getSpriteColor();
-                m_cells[bufferIndex][vertex + 3].color = sprite->getSpriteColor();
+                frame.cells[bufferIndex][vertex + 0].color = sprite->getSpriteColor();
+                frame.cells[bufferIndex][vertex + 1].color = sprite->getSpriteColor();
+                frame.cells[bufferIndex][vertex + 2].color = sprite->getSpriteColor();
+                frame.cells[bufferIndex][vertex + 3].color = sprite->getSpriteColor();
 
-                m_howManyToDraw[bufferIndex] += 4;
+                frame.howManyToDraw[bufferIndex] += 4;
             }
         }
     }
 
-    void RendererHexGridStaticSprites::finalizeUpdate(sf::RenderTarget& renderTarget)
+    void RendererHexGridStaticSprites::render(sf::RenderTarget& renderTarget)
     {
+        auto& frame = m_frames[front()];
         for (std::uint8_t type = 0; type < m_buffer.size(); type++)
         {
-            m_states[type].texture = m_texture[type];
-            m_buffer[type].update(m_cells[type].data());
+            m_states[type].texture = frame.texture[type];
+            m_buffer[type].update(frame.cells[type].data());
 
-            renderTarget.draw(m_buffer[type], 0, m_howManyToDraw[type], m_states[type]);
+            renderTarget.draw(m_buffer[type], 0, frame.howManyToDraw[type], m_states[type]);
         }
     }
 
@@ -22,6 +22,8 @@ THE SOFTWARE.
 
 #include "RendererParticleSystem.hpp"
 
+#include <algorithm>
+
 namespace systems
 {
     // --------------------------------------------------------------
@@ -31,7 +33,7 @@ namespace systems
     // to everyone else.
     //
     // --------------------------------------------------------------
-    void RendererParticleSystem::update(systems::ParticleSystem& ps, sf::RenderTarget& renderTarget)
+    void RendererParticleSystem::update(systems::ParticleSystem& ps, sf::RenderTarget& renderTarget, const std::chrono::microseconds sinceUpdate)
     {
         math::Point2f position{};
         for (decltype(ps.m_particleCount) p = 0; p < ps.m_particleCount; p++)
@@ -41,11 +43,12 @@ namespace systems
             // We compute the position here, rather than doing an update of the position in the system,
             // because the camera zoom can change and when that happens, we need to ensure the position
             // is recomputed based on the new zoom state
-            position.x = particle->origin.x + particle->alive.count() * particle->speed * particle->direction.x;
-            position.y = particle->origin.y + particle->alive.count() * particle->speed * particle->direction.y;
+            auto alive = std::min(particle->alive + sinceUpdate, particle->lifetime);
+            position.x = particle->origin.x + alive.count() * particle->speed * particle->direction.x;
+            position.y = particle->origin.y + alive.count() * particle->speed * particle->direction.y;
             particle->sprite.setPosition(position);
 
-            particle->sprite.setRotation(particle->rotation);
+            particle->sprite.setRotation(particle->rotation + particle->rotationRate * (alive - particle->alive).count());
 
             particle->sprite.setTextureRect(particle->getCurrentSpriteRect());
 
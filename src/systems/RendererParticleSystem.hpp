@@ -32,13 +32,16 @@ namespace systems
     // --------------------------------------------------------------
     //
     // This system knows how to render the particles in a particle system.
-    // Turns out to be prety simple.
+    // Turns out to be prety simple.  Because the simulation runs at a fixed
+    // rate, the particles are drawn where they will be after the time the
+    // display is ahead of the simulation (sinceUpdate), keeping their motion
+    // smooth at any refresh rate.
     //
     // --------------------------------------------------------------
     class RendererParticleSystem : public System
     {
       public:
-        void update(systems::ParticleSystem& ps, sf::RenderTarget& renderTarget);
+        void update(systems::ParticleSystem& ps, sf::RenderTarget& renderTarget, const std::chrono::microseconds sinceUpdate);
 
       private:
         using System::update; // disables compiler warning from clang
@@ -26,56 +26,185 @@
 #include "components/Position.hpp"
 #include "components/Property.hpp"
 
+#include <algorithm>
+#include <ranges>
+
 namespace systems
 {
+    void RuleExecute::clear()
+    {
+        System::clear();
+        for (auto&& row : m_gridCount)
+        {
+            std::ranges::fill(row, static_cast<std::uint16_t>(0));
+        }
+        m_idToCoord.clear();
+        m_crowdedCells.clear();
+    }
+
+    bool RuleExecute::addEntity(entities::EntityPtr entity)
+    {
+        bool added{ false };
+        if (added = System::addEntity(entity); added && !m_idToCoord.contains(entity->getId()))
+        {
+            auto position = entity->getComponent<components::Position>()->get();
+            increment(position);
+            m_idToCoord[entity->getId()] = position;
+        }
+
+        return added;
+    }
+
+    void RuleExecute::removeEntity(entities::Entity::IdType entityId)
+    {
+        if (m_idToCoord.contains(entityId))
+        {
+            decrement(m_idToCoord[entityId]);
+            m_idToCoord.erase(entityId);
+        }
+
+        System::removeEntity(entityId);
+    }
+
+    void RuleExecute::updatedEntity(entities::EntityPtr entity)
+    {
+        if (m_idToCoord.contains(entity->getId()))
+        {
+            if (!isInterested(entity))
+            {
+                removeEntity(entity->getId());
+            }
+            else
+            {
+                // If the entity moved, its old cell loses it and the new cell gains it
+                auto position = entity->getComponent<components::Position>()->get();
+                if (position != m_idToCoord[entity->getId()])
+                {
+                    decrement(m_idToCoord[entity->getId()]);
+                    increment(position);
+                    m_idToCoord[entity->getId()] = position;
+                }
+            }
+        }
+        else
+        {
+            addEntity(entity);
+        }
+    }
+
+    void RuleExecute::increment(const misc::HexCoord& cell)
+    {
+        if (++m_gridCount[cell.r][cell.q] == 2)
+        {
+            m_crowdedCells.insert(cell);
+        }
+    }
+
+    void RuleExecute::decrement(const misc::HexCoord& cell)
+    {
+        if (--m_gridCount[cell.r][cell.q] == 1)
+        {
+            m_crowdedCells.erase(cell);
+        }
+    }
+
     void RuleExecute::update([[maybe_unused]] std::chrono::microseconds elapsedTime)
     {
-        for (auto&& [id, entity] : m_entities)
+        for (auto&& cell : m_crowdedCells)
         {
-            checkAction(entity);
+            checkAction(cell);
         }
+
+        for (auto&& [id, reason] : m_removals)
+        {
+            m_notifyRemove(id, reason);
+        }
+        m_removals.clear();
+        m_removalIndex.clear();
     }
 
     // --------------------------------------------------------------
     //
     // An entity may have moved or rules have changed, this is where
-    // we check to see if something should take place in terms of
-    // being wiped out!
+    // we check to see if something in this cell should be wiped out!
     //
     // --------------------------------------------------------------
-    void RuleExecute::checkAction(entities::EntityPtr entity)
+    void RuleExecute::checkAction(const misc::HexCoord& cell)
     {
-        auto abilityEntity = entity->getComponent<components::Ability>();
-        auto propertyEntity = entity->getComponent<components::Property>();
-        auto position = entity->getComponent<components::Position>()->get();
-        for (auto&& [id, entityInPlace] : m_level->getEntities(position))
+        static const auto WATER = static_cast<std::uint16_t>(components::PropertyType::Water);
+        static const auto HOT = static_cast<std::uint16_t>(components::PropertyType::Hot);
+        static const auto FLOAT = static_cast<std::uint16_t>(components::AbilityType::Float);
+        static const auto CHILL = static_cast<std::uint16_t>(components::AbilityType::Chill);
+
+        // Find out if anything in this cell is water or hot, and whether everything
+        // in the cell is able to survive it.  If so, nothing can happen here.
+        std::uint16_t properties{ 0 };
+        std::uint16_t allAbilities{ 0xffff };
+        for (auto&& entity : m_level->getEntities(cell) | std::views::values)
         {
-            if (entityInPlace->getId() != entity->getId())
+            if (entity->hasComponent<components::Property>() && entity->hasComponent<components::Ability>())
+            {
+                properties |= static_cast<std::uint16_t>(entity->getComponent<components::Property>()->get());
+                allAbilities &= static_cast<std::uint16_t>(entity->getComponent<components::Ability>()->get());
+            }
+        }
+        bool checkWater = (properties & WATER) && !(allAbilities & FLOAT);
+        bool checkHot = (properties & HOT) && !(allAbilities & CHILL);
+        if (!checkWater && !checkHot)
+        {
+            return;
+        }
+
+        for (auto&& [id, source] : m_level->getEntities(cell))
+        {
+            if (!source->hasComponent<components::Property>() || !source->hasComponent<components::Ability>())
+            {
+                continue;
+            }
+            auto sourceProperty = source->getComponent<components::Property>();
+            bool isWater = checkWater && sourceProperty->has(components::PropertyType::Water);
+            bool isHot = checkHot && sourceProperty->has(components::PropertyType::Hot);
+            if (!isWater && !isHot)
             {
-                if (entityInPlace->hasComponent<components::Property>())
+                continue;
+            }
+
+            for (auto&& [otherId, other] : m_level->getEntities(cell))
+            {
+                if (otherId != id && other->hasComponent<components::Property>() && other->hasComponent<components::Ability>())
                 {
-                    auto abilityInPlace = entityInPlace->getComponent<components::Ability>();
-                    auto propertyInPlace = entityInPlace->getComponent<components::Property>();
-                    if (propertyInPlace->has(components::PropertyType::Water) && !abilityEntity->has(components::AbilityType::Float))
-                    {
-                        m_notifyRemove(entity->getId(), RemoveReason::Water);
-                        m_notifyRemove(entityInPlace->getId(), RemoveReason::Collateral);
-                    }
-                    if (propertyEntity->has(components::PropertyType::Water) && !abilityInPlace->has(components::AbilityType::Float))
+                    auto otherAbility = other->getComponent<components::Ability>();
+                    if (isWater && !otherAbility->has(components::AbilityType::Float))
                     {
-                        m_notifyRemove(entityInPlace->getId(), RemoveReason::Water);
-                        m_notifyRemove(entity->getId(), RemoveReason::Collateral);
+                        remove(otherId, RemoveReason::Water);
+                        remove(id, RemoveReason::Collateral);
                     }
-                    if (propertyInPlace->has(components::PropertyType::Hot) && !abilityEntity->has(components::AbilityType::Chill))
+                    if (isHot && !otherAbility->has(components::AbilityType::Chill))
                     {
-                        m_notifyRemove(entity->getId(), RemoveReason::Hot);
-                    }
-                    if (propertyEntity->has(components::PropertyType::Hot) && !abilityInPlace->has(components::AbilityType::Chill))
-                    {
-                        m_notifyRemove(entityInPlace->getId(), RemoveReason::Hot);
+                        remove(otherId, RemoveReason::Hot);
                     }
                 }
             }
         }
     }
+
+    // --------------------------------------------------------------
+    //
+    // Records the entity for removal, only once.  If it is removed for
+    // more than one reason, being sunk or burned wins over collateral,
+    // so the effect for it is shown.
+    //
+    // --------------------------------------------------------------
+    void RuleExecute::remove(entities::Entity::IdType entityId, RemoveReason reason)
+    {
+        if (!m_removalIndex.contains(entityId))
+        {
+            m_removalIndex[entityId] = m_removals.size();
+            m_removals.push_back({ entityId, reason });
+        }
+        else if (m_removals[m_removalIndex[entityId]].second == RemoveReason::Collateral)
+        {
+            m_removals[m_removalIndex[entityId]].second = reason;
+        }
+    }
 } // namespace systems
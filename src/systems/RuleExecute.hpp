@@ -26,11 +26,15 @@
 #include "System.hpp"
 #include "components/Ability.hpp"
 #include "components/Position.hpp"
+#include "misc/HexCoord.hpp"
 
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <optional>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace systems
@@ -60,14 +64,37 @@ namespace systems
             m_level(level),
             m_notifyRemove(notifyRemove)
         {
+            // Same number of cells as the level, used to keep a count of the entities in each of them
+            m_gridCount.resize(level->getHeight());
+            for (auto&& row : m_gridCount)
+            {
+                row.resize(level->getWidth(), static_cast<std::uint16_t>(0));
+            }
         }
 
+        void clear() override;
+        bool addEntity(entities::EntityPtr entity) override;
+        void removeEntity(entities::Entity::IdType entityId) override;
+        void updatedEntity(entities::EntityPtr entity) override;
+
         void update(std::chrono::microseconds elapsedTime) override;
 
       private:
         std::shared_ptr<Level> m_level;
         std::function<void(entities::Entity::IdType, RemoveReason)> m_notifyRemove;
 
-        void checkAction(entities::EntityPtr entity);
+        std::vector<std::vector<std::uint16_t>> m_gridCount;
+        std::unordered_map<entities::Entity::IdType, misc::HexCoord> m_idToCoord;
+        // Only cells with more than one entity can have anything happen in them
+        std::unordered_set<misc::HexCoord> m_crowdedCells;
+
+        // Each entity is only removed once per update, these are kept around to avoid reallocating every update
+        std::vector<std::pair<entities::Entity::IdType, RemoveReason>> m_removals;
+        std::unordered_map<entities::Entity::IdType, std::size_t> m_removalIndex;
+
+        void checkAction(const misc::HexCoord& cell);
+        void remove(entities::Entity::IdType entityId, RemoveReason reason);
+        void increment(const misc::HexCoord& cell);
+        void decrement(const misc::HexCoord& cell);
     };
 } // namespace systems
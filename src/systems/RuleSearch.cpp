@@ -53,16 +53,6 @@
 
 namespace systems
 {
-    static const auto isDirection = [](auto entity)
-    {
-        return entity->template hasComponent<components::PhraseDirection>();
-    };
-
-    static const auto isNotDirection = [](auto entity)
-    {
-        return !entity->template hasComponent<components::PhraseDirection>();
-    };
-
     // --------------------------------------------------------------
     //
     // A simple hash computation, used in determining which are newly
@@ -155,12 +145,159 @@ namespace systems
         }
     }
 
+    void RuleSearch::clear()
+    {
+        // Treated the same as removing each of them, so the next rule application still
+        // reports the goal/send/I entities that went away.
+        for (auto&& id : m_entities | std::views::keys)
+        {
+            untrack(id);
+        }
+        System::clear();
+
+        // Whatever comes next starts from scratch
+        m_applyAll = true;
+    }
+
+    bool RuleSearch::addEntity(entities::EntityPtr entity)
+    {
+        bool added{ false };
+        if (added = System::addEntity(entity); added)
+        {
+            track(entity);
+        }
+
+        return added;
+    }
+
+    void RuleSearch::removeEntity(entities::Entity::IdType entityId)
+    {
+        untrack(entityId);
+        System::removeEntity(entityId);
+    }
+
+    void RuleSearch::updatedEntity(entities::EntityPtr entity)
+    {
+        System::updatedEntity(entity);
+        if (m_entities.contains(entity->getId()))
+        {
+            // Its Object type may have changed, so it might need to move to a different bucket
+            track(entity);
+        }
+        else
+        {
+            untrack(entity->getId());
+        }
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Gives the entity a slot (if it doesn't already have one) and
+    // places it in the bucket for its current Object type.
+    //
+    // --------------------------------------------------------------
+    void RuleSearch::track(entities::EntityPtr entity)
+    {
+        if (!m_tracking.contains(entity->getId()))
+        {
+            std::size_t slot{ m_slotToId.size() };
+            if (!m_freeSlots.empty())
+            {
+                slot = m_freeSlots.back();
+                m_freeSlots.pop_back();
+                m_slotToId[slot] = entity->getId();
+            }
+            else
+            {
+                m_slotToId.push_back(entity->getId());
+            }
+            m_tracking[entity->getId()] = { slot, std::nullopt, false };
+        }
+
+        // New (or returning) entities, and those that changed type, still need the current rules applied
+        bool returning = !m_tracking[entity->getId()].alive;
+        m_tracking[entity->getId()].alive = true;
+        if (bucket(entity) || returning)
+        {
+            m_dirtyEntities.insert(entity->getId());
+        }
+    }
+
+    void RuleSearch::untrack(entities::Entity::IdType entityId)
+    {
+        if (m_tracking.contains(entityId) && m_tracking[entityId].alive)
+        {
+            auto& tracking = m_tracking[entityId];
+            if (tracking.type.has_value())
+            {
+                m_entitiesByType[static_cast<std::size_t>(tracking.type.value())].erase(entityId);
+                tracking.type = std::nullopt;
+            }
+            tracking.alive = false;
+            m_retiredSlots.push_back(tracking.slot);
+            m_dirtyEntities.erase(entityId);
+        }
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Makes sure the entity is in the bucket of its current Object
+    // type, and no other bucket.  Returns true if it changed buckets.
+    //
+    // --------------------------------------------------------------
+    bool RuleSearch::bucket(entities::EntityPtr entity)
+    {
+        auto& tracking = m_tracking[entity->getId()];
+        std::optional<components::ObjectType> type{ std::nullopt };
+        if (entity->hasComponent<components::Object>())
+        {
+            type = entity->getComponent<components::Object>()->getType();
+        }
+
+        if (type != tracking.type)
+        {
+            if (tracking.type.has_value())
+            {
+                m_entitiesByType[static_cast<std::size_t>(tracking.type.value())].erase(entity->getId());
+            }
+            if (type.has_value())
+            {
+                m_entitiesByType[static_cast<std::size_t>(type.value())][entity->getId()] = entity;
+            }
+            tracking.type = type;
+            return true;
+        }
+
+        return false;
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Once the removed entities have been reported as changed, their
+    // slots can be used again.  Any that came back in the meantime (undo)
+    // are still alive and keep their slot.
+    //
+    // --------------------------------------------------------------
+    void RuleSearch::releaseRetiredSlots()
+    {
+        for (auto&& slot : m_retiredSlots)
+        {
+            auto id = m_slotToId[slot];
+            if (m_tracking.contains(id) && !m_tracking[id].alive && m_tracking[id].slot == slot)
+            {
+                m_tracking.erase(id);
+                m_freeSlots.push_back(slot);
+            }
+        }
+        m_retiredSlots.clear();
+    }
+
     void RuleSearch::update([[maybe_unused]] std::chrono::microseconds elapsedTime)
     {
         if (m_updateRules)
         {
             // Remove all previous phrase direction entities
-            for (auto&& entity : m_entities | std::views::values | std::views::filter(isDirection))
+            for (auto&& entity : m_directions)
             {
                 m_removeEntity(entity->getId());
             }
@@ -210,7 +347,6 @@ namespace systems
                     notifyNewPhrases(phrases);
                     m_previousPhrases = phrases;
 
-                    clean();
                     // Find the semantic rules
                     systems::parser::SemanticParser semanticParser;
                     systems::parser::SemanticParser::SemanticRuleSet allRules;
@@ -249,16 +385,14 @@ namespace systems
     // --------------------------------------------------------------
     //
     // Given a rules traversal, can now go through the entities and
-    // apply the relevant rules.
+    // apply the relevant rules.  The rules are first reduced to the
+    // effective rules for each Object type.  Only the types whose
+    // effective rules are different from last time are touched, along
+    // with any entities that are new or changed type since then.
     //
     // --------------------------------------------------------------
     void RuleSearch::applyRules(const systems::parser::SemanticParser::SemanticRuleSet& rules)
     {
-        static const auto isObject = [](entities::EntityPtr entity)
-        {
-            return entity->template hasComponent<components::Object>();
-        };
-
         //
         // Step 1: Handle all the Noun (except for I) to Noun rules.  We want to get this done
         //         before applying properties and abilities so that we only have the final
@@ -275,13 +409,16 @@ namespace systems
                             using T = std::decay_t<decltype(arg)>;
                             if constexpr (std::is_same_v<T, components::NounType>)
                             {
-                                for (auto&& entity : m_entities | std::views::values | std::views::filter(isObject))
+                                // Take the whole bucket, each entity is placed back into the bucket of its new type
+                                auto& from = m_entitiesByType[static_cast<std::size_t>(components::NounTypeToObjectType.at(noun))];
+                                auto transforming = std::move(from);
+                                from.clear();
+                                for (auto&& [id, entity] : transforming)
                                 {
-                                    if (entity->template getComponent<components::Object>()->getType() == components::NounTypeToObjectType.at(noun))
-                                    {
-                                        entities::transformNoun(entity, arg);
-                                        m_notifyUpdated(entity->getId());
-                                    }
+                                    entities::transformNoun(entity, arg);
+                                    bucket(entity);
+                                    m_dirtyEntities.insert(id);
+                                    m_notifyUpdated(id);
                                 }
                             }
                         },
@@ -291,14 +428,14 @@ namespace systems
         }
 
         //
-        // Step 2: Handle all the Noun (except for I) based on Property/Ability rules
-        entities::EntitySet currentGoalEntities;
-        entities::EntitySet currentSendEntities;
+        // Step 2: Reduce the Noun (except for I) based on Property/Ability rules to the
+        //         effective rules for each Object type
+        std::array<EffectiveRules, static_cast<std::size_t>(components::ObjectType::SIZE)> effective{};
         for (auto&& [noun, functions] : rules)
         {
             if (noun != components::NounType::I)
             {
-                auto object = components::NounTypeToObjectType.at(noun);
+                auto type = static_cast<std::size_t>(components::NounTypeToObjectType.at(noun));
                 for (auto&& function : functions)
                 {
                     std::visit(
@@ -307,34 +444,11 @@ namespace systems
                             using T = std::decay_t<decltype(arg)>;
                             if constexpr (std::is_same_v<T, components::AbilityType>)
                             {
-                                // I promise I tried to use a view filter, but couldn't get it to compile (even though the syntax was correct!)
-                                for (auto&& entity : m_entities | std::views::values)
-                                {
-                                    if (entity->template hasComponent<components::Object>() && entity->template getComponent<components::Object>()->getType() == object)
-                                    {
-                                        if (arg == components::AbilityType::Send)
-                                        {
-                                            currentSendEntities.insert(entity->getId());
-                                        }
-                                        entity->template getComponent<components::Ability>()->add(arg);
-                                        m_notifyUpdated(entity->getId());
-                                    }
-                                }
+                                effective[type].abilities |= static_cast<std::uint16_t>(arg);
                             }
                             else if constexpr (std::is_same_v<T, components::PropertyType>)
                             {
-                                // I promise I tried to use a view filter, but couldn't get it to compile (even though the syntax was correct!)
-                                for (auto&& entity : m_entities | std::views::values)
-                                {
-                                    if (entity->template hasComponent<components::Object>() && entity->template getComponent<components::Object>()->getType() == object)
-                                    {
-                                        if (arg == components::PropertyType::Goal)
-                                        {
-                                            currentGoalEntities.insert(entity->getId());
-                                        }
-                                        entity->template getComponent<components::Property>()->add(arg);
-                                    }
-                                }
+                                effective[type].properties |= static_cast<std::uint16_t>(arg);
                             }
                         },
                         function);
@@ -343,11 +457,11 @@ namespace systems
         }
 
         //
-        // Step 3: Handle the I (Noun) rules.
+        // Step 3: Add the I (Noun) rules to the effective rules.
 
         // First step in this process is to collect all the "I" abilities so they
         // can be applied at once.
-        auto abilitiesOfI = std::make_unique<components::Ability>(components::AbilityType::None);
+        std::uint16_t abilitiesOfI{ 0 };
         if (rules.contains(components::NounType::I))
         {
             for (auto&& functionType : rules.at(components::NounType::I))
@@ -358,15 +472,13 @@ namespace systems
                         using T = std::decay_t<decltype(arg)>;
                         if constexpr (std::is_same_v<T, components::AbilityType>)
                         {
-                            abilitiesOfI->add(arg);
+                            abilitiesOfI |= static_cast<std::uint16_t>(arg);
                         }
                     },
                     functionType);
             }
         }
-        // Now, apply these abilities to all of the "I" nouns
-        bool anyI{ false };
-        entities::EntitySet currentIEntities;
+        // Now, these abilities go to all of the "I" nouns
         if (rules.contains(components::NounType::I))
         {
             for (auto&& function : rules.at(components::NounType::I))
@@ -377,36 +489,79 @@ namespace systems
                         using T = std::decay_t<decltype(arg)>;
                         if constexpr (std::is_same_v<T, components::NounType>)
                         {
-                            auto object = components::NounTypeToObjectType.at(arg);
-                            // Find all the matching entities and apply
-                            for (auto&& [id, entity] : m_entities)
-                            {
-                                if (entity->template hasComponent<components::Object>() && entity->template getComponent<components::Object>()->getType() == object)
-                                {
-                                    currentIEntities.insert(entity->getId());
-
-                                    entity->addComponent(std::make_unique<components::InputControlled>());
-                                    entity->addComponent(std::make_unique<components::Audio>(content::KEY_AUDIO_STEP));
-                                    entity->template getComponent<components::Ability>()->add(abilitiesOfI->get());
-                                    entity->template getComponent<components::Property>()->add(components::PropertyType::I);
-
-                                    anyI = true;
-                                }
-                            }
+                            auto type = static_cast<std::size_t>(components::NounTypeToObjectType.at(arg));
+                            effective[type].isI = true;
+                            effective[type].abilities |= abilitiesOfI;
+                            effective[type].properties |= static_cast<std::uint16_t>(components::PropertyType::I);
                         }
                     },
                     function);
             }
         }
 
-        notifyGoalChanges(currentGoalEntities);
-        notifySendChanges(currentSendEntities);
-        notifyIChanges(currentIEntities);
+        //
+        // Step 4: Apply to the types whose rules changed, then to the remaining new entities,
+        //         while finding the current goal, send, and I entities
+        bool anyI{ false };
+        misc::Bitset currentGoalSlots(m_slotToId.size());
+        misc::Bitset currentSendSlots(m_slotToId.size());
+        misc::Bitset currentISlots(m_slotToId.size());
+        for (std::size_t type = 0; type < m_entitiesByType.size(); type++)
+        {
+            bool changed = m_applyAll || effective[type] != m_appliedRules[type];
+            bool isGoal = effective[type].properties & static_cast<std::uint16_t>(components::PropertyType::Goal);
+            bool isSend = effective[type].abilities & static_cast<std::uint16_t>(components::AbilityType::Send);
+            if (!changed && !isGoal && !isSend && !effective[type].isI)
+            {
+                continue;
+            }
+
+            for (auto&& [id, entity] : m_entitiesByType[type])
+            {
+                if (changed)
+                {
+                    apply(entity, effective[type]);
+                    m_dirtyEntities.erase(id);
+                    m_notifyUpdated(id);
+                }
+                if (isGoal)
+                {
+                    currentGoalSlots.set(m_tracking[id].slot);
+                }
+                if (isSend)
+                {
+                    currentSendSlots.set(m_tracking[id].slot);
+                }
+                if (effective[type].isI)
+                {
+                    currentISlots.set(m_tracking[id].slot);
+                    anyI = true;
+                }
+            }
+        }
+        for (auto&& id : m_dirtyEntities)
+        {
+            if (m_tracking.contains(id) && m_tracking[id].type.has_value())
+            {
+                apply(m_entities[id], effective[static_cast<std::size_t>(m_tracking[id].type.value())]);
+                m_notifyUpdated(id);
+            }
+        }
+        m_dirtyEntities.clear();
+        m_appliedRules = effective;
+        m_applyAll = false;
+        // Properties were changed in place, the level doesn't otherwise know about it
+        m_level->invalidateSummaries();
+
+        notifyGoalChanges(currentGoalSlots);
+        notifySendChanges(currentSendSlots);
+        notifyIChanges(currentISlots);
+        releaseRetiredSlots();
 
         // If there are no I entities, then give the user a hint about the undo system
         if (!anyI && m_timeSinceUndoHint >= MIN_UNDOHINT_DELAY)
         {
-            auto hint = std::make_shared<entities::Entity>();
+            auto hint = entities::create();
             std::string hintString{};
             if (ControllerInput::instance().hasControllerBeenUsed())
             {
@@ -425,27 +580,30 @@ namespace systems
 
     // --------------------------------------------------------------
     //
-    // Scan through the entities and remove any abilities and properties
-    // from them.
+    // Replaces whatever properties and abilities the entity had with
+    // the rules for its type, adding or removing the components that
+    // go along with being an "I".
     //
     // --------------------------------------------------------------
-    void RuleSearch::clean()
+    void RuleSearch::apply(entities::EntityPtr entity, const EffectiveRules& rules)
     {
-        for (auto&& entity : m_entities | std::views::values | std::views::filter(isNotDirection))
+        auto property = entity->getComponent<components::Property>();
+        property->reset();
+        property->add(static_cast<components::PropertyType>(rules.properties));
+
+        auto ability = entity->getComponent<components::Ability>();
+        ability->reset();
+        ability->add(static_cast<components::AbilityType>(rules.abilities));
+
+        if (rules.isI)
         {
-            if (entity->template hasComponent<components::Property>())
-            {
-                entity->template getComponent<components::Property>()->reset();
-            }
-            if (entity->template hasComponent<components::Ability>())
-            {
-                entity->template getComponent<components::Ability>()->reset();
-            }
-            if (entity->template hasComponent<components::InputControlled>())
-            {
-                entity->template removeComponent<components::InputControlled>();
-                entity->template removeComponent<components::Audio>();
-            }
+            entity->addComponent(std::make_unique<components::InputControlled>());
+            entity->addComponent(std::make_unique<components::Audio>(content::KEY_AUDIO_STEP));
+        }
+        else if (entity->hasComponent<components::InputControlled>())
+        {
+            entity->removeComponent<components::InputControlled>();
+            entity->removeComponent<components::Audio>();
         }
     }
 
@@ -469,36 +627,49 @@ namespace systems
         m_previousHashes.swap(currentHashes);
     }
 
+    // --------------------------------------------------------------
+    //
+    // Every entity whose slot differs between the previous and current
+    // sets has changed and everyone needs to know about it.
+    //
+    // --------------------------------------------------------------
+    void RuleSearch::notifySlotChanges(const misc::Bitset& changed)
+    {
+        changed.forEach([this](std::size_t slot)
+                        {
+                            m_notifyUpdated(m_slotToId[slot]);
+                        });
+    }
+
+    entities::EntitySet RuleSearch::slotsToEntities(const misc::Bitset& slots)
+    {
+        entities::EntitySet ids;
+        slots.forEach([this, &ids](std::size_t slot)
+                      {
+                          ids.insert(m_slotToId[slot]);
+                      });
+
+        return ids;
+    }
+
     // --------------------------------------------------------------
     //
     // When the I rule(s) change, the game model needs to be notified
     // of the new rules, along with any entities that have changed.
     //
     // --------------------------------------------------------------
-    void RuleSearch::notifyIChanges(entities::EntitySet& current)
+    void RuleSearch::notifyIChanges(misc::Bitset& current)
     {
-        // Entities that are I
-        for (auto&& test : current)
-        {
-            if (!m_previousIEntities.contains(test))
-            {
-                m_notifyUpdated(test);
-            }
-        }
-        for (auto&& test : m_previousIEntities)
-        {
-            if (!current.contains(test))
-            {
-                m_notifyUpdated(test);
-            }
-        }
+        auto changed = current ^ m_previousISlots;
+        notifySlotChanges(changed);
 
         // Rule changes
-        if (current != m_previousIEntities)
+        if (changed.any())
         {
             // The reason for doing it in this order is to ensure that if the code that
             // accepts the entities hangs onto it for a while, it will continue to be valid.
-            m_previousIEntities = std::move(current);
+            m_previousIEntities = slotsToEntities(current);
+            m_previousISlots = std::move(current);
             m_notifyIChanged(m_previousIEntities);
         }
     }
@@ -509,28 +680,16 @@ namespace systems
     // of the updated/new goal entities.
     //
     // --------------------------------------------------------------
-    void RuleSearch::notifyGoalChanges(entities::EntitySet& current)
+    void RuleSearch::notifyGoalChanges(misc::Bitset& current)
     {
-        // Entities that are goals
-        for (auto&& test : current)
-        {
-            if (!m_previousGoalEntities.contains(test))
-            {
-                m_notifyUpdated(test);
-            }
-        }
-        for (auto&& test : m_previousGoalEntities)
-        {
-            if (!current.contains(test))
-            {
-                m_notifyUpdated(test);
-            }
-        }
+        auto changed = current ^ m_previousGoalSlots;
+        notifySlotChanges(changed);
 
         // Rule changes
-        if (current != m_previousGoalEntities)
+        if (changed.any())
         {
-            m_previousGoalEntities = std::move(current);
+            m_previousGoalEntities = slotsToEntities(current);
+            m_previousGoalSlots = std::move(current);
             m_notifyGoalChanged(m_previousGoalEntities);
         }
     }
@@ -541,27 +700,14 @@ namespace systems
     // of the updated/new send entities
     //
     // --------------------------------------------------------------
-    void RuleSearch::notifySendChanges(entities::EntitySet& current)
+    void RuleSearch::notifySendChanges(misc::Bitset& current)
     {
-        // Entities that are send
-        for (auto&& test : current)
-        {
-            if (!m_previousSendEntities.contains(test))
-            {
-                m_notifyUpdated(test);
-            }
-        }
-        for (auto&& test : m_previousSendEntities)
-        {
-            if (!current.contains(test))
-            {
-                m_notifyUpdated(test);
-            }
-        }
+        auto changed = current ^ m_previousSendSlots;
+        notifySlotChanges(changed);
 
-        if (current != m_previousSendEntities)
+        if (changed.any())
         {
-            m_previousSendEntities = std::move(current);
+            m_previousSendSlots = std::move(current);
         }
     }
 } // namespace systems
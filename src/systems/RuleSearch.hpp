@@ -32,15 +32,18 @@
 #include "components/Property.hpp"
 #include "components/Verb.hpp"
 #include "entities/Entity.hpp"
+#include "misc/Bitset.hpp"
 #include "systems/parser/Parser.hpp"
 #include "systems/parser/PhraseSearch.hpp"
 #include "systems/parser/SemanticParser.hpp"
 
+#include <array>
 #include <chrono>
 #include <deque>
 #include <functional>
 #include <optional>
 #include <tuple>
+#include <unordered_map>
 #include <unordered_set>
 #include <variant>
 #include <vector>
@@ -64,10 +67,17 @@ namespace systems
             m_notifyUpdated(notifyUpdated),
             m_notifyGoalChanged(notifyGoalChanged),
             m_notifyIChanged(notifyIChanged),
-            m_notifyNewPhrase(notifyNewPhrase)
+            m_notifyNewPhrase(notifyNewPhrase),
+            m_directions(Query().with<components::PhraseDirection>())
         {
+            declare(m_directions);
         }
 
+        void clear() override;
+        bool addEntity(entities::EntityPtr entity) override;
+        void removeEntity(entities::Entity::IdType entityId) override;
+        void updatedEntity(entities::EntityPtr entity) override;
+
         void update(std::chrono::microseconds elapsedTime) override;
         void signalStateChange()
         {
@@ -94,23 +104,64 @@ namespace systems
         std::function<void(const entities::EntitySet&)> m_notifyGoalChanged;
         std::function<void(const std::unordered_set<entities::Entity::IdType>&)> m_notifyIChanged;
         std::function<void(misc::HexCoord position)> m_notifyNewPhrase;
+        Query m_directions;
         components::PhraseDirection::DirectionGrid m_gridPhraseDirection;
         std::uint32_t m_previousPhrasesHash{ 0 };
         std::vector<std::deque<systems::parser::Parser::PhrasePair>> m_previousPhrases;
         std::unordered_set<std::uint32_t> m_previousHashes;
         entities::EntitySet m_previousGoalEntities;
-        entities::EntitySet m_previousSendEntities;
         entities::EntitySet m_previousIEntities;
 
+        // Every tracked entity is given a dense slot, used as its index into the goal/send/I bitsets.
+        // A removed entity holds onto its slot until the next rule application has reported it as
+        // changed; an undo brings the same id back and it picks up the same slot again.
+        struct Tracking
+        {
+            std::size_t slot;
+            std::optional<components::ObjectType> type;
+            bool alive;
+        };
+        std::unordered_map<entities::Entity::IdType, Tracking> m_tracking;
+        std::vector<entities::Entity::IdType> m_slotToId;
+        std::vector<std::size_t> m_freeSlots;
+        std::vector<std::size_t> m_retiredSlots;
+        misc::Bitset m_previousGoalSlots;
+        misc::Bitset m_previousSendSlots;
+        misc::Bitset m_previousISlots;
+
+        // Entities that have an Object component, by their type, so each rule only visits its own noun
+        std::array<entities::EntityMap, static_cast<std::size_t>(components::ObjectType::SIZE)> m_entitiesByType;
+
+        // The combined result of all the rules for one Object type
+        struct EffectiveRules
+        {
+            std::uint16_t properties{ 0 };
+            std::uint16_t abilities{ 0 };
+            bool isI{ false };
+
+            bool operator==(const EffectiveRules& rhs) const = default;
+        };
+        // What was applied last time, only the types that differ from this need to be touched again
+        std::array<EffectiveRules, static_cast<std::size_t>(components::ObjectType::SIZE)> m_appliedRules;
+        bool m_applyAll{ true };
+        entities::EntitySet m_dirtyEntities;
+
         static constexpr auto MIN_UNDOHINT_DELAY = std::chrono::seconds{ 20 };
         std::chrono::microseconds m_timeSinceUndoHint{ MIN_UNDOHINT_DELAY };
 
         void updateNotifications(std::chrono::microseconds& elapsedTime);
         void applyRules(const systems::parser::SemanticParser::SemanticRuleSet& rules);
-        void clean();
+        void apply(entities::EntityPtr entity, const EffectiveRules& rules);
         void notifyNewPhrases(std::vector<std::deque<systems::parser::Parser::PhrasePair>>& current);
-        void notifyIChanges(entities::EntitySet& currentEntities);
-        void notifyGoalChanges(entities::EntitySet& currentEntities);
-        void notifySendChanges(entities::EntitySet& currentEntities);
+        void notifyIChanges(misc::Bitset& current);
+        void notifyGoalChanges(misc::Bitset& current);
+        void notifySendChanges(misc::Bitset& current);
+        void notifySlotChanges(const misc::Bitset& changed);
+        entities::EntitySet slotsToEntities(const misc::Bitset& slots);
+
+        void track(entities::EntityPtr entity);
+        void untrack(entities::Entity::IdType entityId);
+        bool bucket(entities::EntityPtr entity);
+        void releaseRetiredSlots();
     };
 } // namespace systems
@@ -52,6 +52,60 @@ namespace systems
         }
     }
 
+    void System::clear()
+    {
+        m_entities.clear();
+        for (auto&& query : m_queries)
+        {
+            query->clear();
+        }
+    }
+
+    // --------------------------------------------------------------
+    //
+    // The batched forms let the game model notify each system with a
+    // single call, and notify different systems at the same time.
+    // Because of that, a system must only touch its own state when
+    // notified.  The declared queries are brought up to date before the
+    // system sees each change.
+    //
+    // --------------------------------------------------------------
+    void System::addEntities(const entities::EntityVector& entities)
+    {
+        for (auto&& entity : entities)
+        {
+            for (auto&& query : m_queries)
+            {
+                query->add(entity);
+            }
+            addEntity(entity);
+        }
+    }
+
+    void System::removeEntities(const std::vector<entities::Entity::IdType>& entityIds)
+    {
+        for (auto&& entityId : entityIds)
+        {
+            for (auto&& query : m_queries)
+            {
+                query->remove(entityId);
+            }
+            removeEntity(entityId);
+        }
+    }
+
+    void System::updatedEntities(const entities::EntityVector& entities)
+    {
+        for (auto&& entity : entities)
+        {
+            for (auto&& query : m_queries)
+            {
+                query->update(entity);
+            }
+            updatedEntity(entity);
+        }
+    }
+
     // --------------------------------------------------------------
     //
     // All systems are asked if they are interested in an entity.  This
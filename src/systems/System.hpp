@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Query.hpp"
 #include "entities/Entity.hpp"
 
 // Disable some compiler warnings that come from ctti
@@ -21,6 +22,7 @@
 #include <chrono>
 #include <initializer_list>
 #include <unordered_set>
+#include <vector>
 
 namespace systems
 {
@@ -45,10 +47,14 @@ namespace systems
         }
         virtual ~System() {}
 
-        virtual void clear() { m_entities.clear(); }
+        virtual void clear();
         virtual bool addEntity(entities::EntityPtr entity);
         virtual void removeEntity(entities::Entity::IdType entityId);
         virtual void updatedEntity(entities::EntityPtr entity);
+        // Batched forms of the above, the game model hands each system all of the changes at once
+        void addEntities(const entities::EntityVector& entities);
+        void removeEntities(const std::vector<entities::Entity::IdType>& entityIds);
+        void updatedEntities(const entities::EntityVector& entities);
         virtual void update([[maybe_unused]] std::chrono::microseconds elapsedTime) {}
         virtual void shutdown() {}
 
@@ -56,9 +62,12 @@ namespace systems
         entities::EntityMap m_entities;
 
         virtual bool isInterested(const entities::EntityPtr& entity);
+        // The query is kept up to date with all the entities the system is told about, not just the ones it is interested in
+        void declare(Query& query) { m_queries.push_back(&query); }
 
       private:
         std::unordered_set<ctti::unnamed_type_id_t> m_interests;
+        std::vector<Query*> m_queries;
     };
 
 } // namespace systems
@@ -30,6 +30,7 @@ THE SOFTWARE.
 #include "services/ConfigurationPath.hpp"
 #include "services/ControllerInput.hpp"
 #include "services/KeyboardInput.hpp"
+#include "services/Replay.hpp"
 
 namespace systems
 {
@@ -84,7 +85,7 @@ namespace systems
         if (m_entities.contains(entityId))
         {
             m_takeSnapshot = true;
-            m_entitiesRemoved.push_back(m_entities[entityId]);
+            m_entitiesRemoved.push_back(entityId);
             System::removeEntity(entityId);
         }
     }
@@ -117,43 +118,38 @@ namespace systems
             {
                 if (!m_surface.contains(id))
                 {
-                    // It is new, need to track it
-                    auto clone = entity->clone();
-
-                    m_surface[id] = clone;
-                    m_stack.top().entitiesNew.insert({ id, clone });
+                    // It is new, need to track it.  The surface keeps its own copy, separate
+                    // from the one saved on the stack, so each can be released on its own.
+                    m_surface[id] = entity->clone();
+                    m_stack.top().entitiesNew.insert({ id, entity->clone() });
                 }                                            // Using this form of the != operator to eliminate a clang compiler warning
                 else if (m_surface[id]->operator!=(*entity)) // Comparing entities for inequality to see if there are any changes
                 {
                     // It has changed in some way, need to track it.
-                    // The previous entity state (in the surface) is tracked in the surface,
-                    // while the new entity state is tracked in the stack.
-                    auto clone = entity->clone();
-                    auto cloneSurface = m_surface[id]->clone();
-
-                    m_stack.top().entitiesNew.insert({ id, clone });
-                    m_stack.top().entitiesPrevious.insert({ id, cloneSurface });
+                    // The previous entity state (in the surface) moves onto the stack,
+                    // while the surface takes a copy of the new entity state.
+                    m_stack.top().entitiesNew.insert({ id, entity->clone() });
+                    m_stack.top().entitiesPrevious.insert({ id, m_surface[id] });
 
-                    m_surface[id] = clone;
+                    m_surface[id] = entity->clone();
                 }
             }
 
             // Handle the removed entities
-            for (auto&& entity : m_entitiesRemoved)
+            for (auto&& entityId : m_entitiesRemoved)
             {
-                // Make a clone of the remove entity from the surface, because it might have
+                // Move the removed entity from the surface onto the stack, because it might have
                 // moved when it was removed, and we need to undo to its previous location
                 // NOTE: The reason for this test is to prevent a program crash when the puzzle
                 //       has entities that are burned right at startup.  A puzzle shouldn't be
                 //       created to do this, but it happens, and we don't want the program
                 //       to crash when that happens.
-                if (m_surface.contains(entity->getId()))
+                if (m_surface.contains(entityId))
                 {
-                    auto clone = m_surface[entity->getId()]->clone();
-                    m_stack.top().entitiesRemoved.push_back(clone);
+                    m_stack.top().entitiesRemoved.push_back(m_surface[entityId]);
                     // Then, remove it from the surfface, because we don't want to keep tracking it
                     // now that it is removed.
-                    m_surface.erase(entity->getId());
+                    m_surface.erase(entityId);
                 }
                 else
                 {
@@ -168,12 +164,14 @@ namespace systems
         actionTaken = m_performUndo || m_performReset;
         if (m_performUndo)
         {
+            Replay::instance().record(Replay::Action::Undo);
             performUndo();
             m_performUndo = false;
         }
 
         if (m_performReset)
         {
+            Replay::instance().record(Replay::Action::Reset);
             performReset();
             m_performReset = false;
         }
@@ -215,11 +213,17 @@ namespace systems
         // never want to undo it, because there is nothing to do if that happens.
         if (m_stack.size() >= 2)
         {
-            // Remove the newly updated entities first
+            // Remove the newly updated entities first.  Neither the saved state of these, nor
+            // the surface copy of it, are referenced anywhere else, so they go back to the arena.
             for (auto&& [id, entity] : m_stack.top().entitiesNew)
             {
                 funcRemoveEntity(entity->getId());
-                m_surface.erase(id);
+                if (auto surface = m_surface.find(id); surface != m_surface.end())
+                {
+                    entities::Arena::current().release(surface->second);
+                    m_surface.erase(surface);
+                }
+                entities::Arena::current().release(entity);
             }
 
             // Next, add back in the previously updated entities
@@ -249,19 +253,37 @@ namespace systems
         //
         // Need to unwind the stack all the way to the first one, because that
         // is the initial set of entities in the level.
+        // None of the saved state in these frames ever becomes live, so it goes back to the arena.
         while (m_stack.size() > 1)
         {
+            for (auto&& [id, entity] : m_stack.top().entitiesNew)
+            {
+                entities::Arena::current().release(entity);
+            }
+            for (auto&& [id, entity] : m_stack.top().entitiesPrevious)
+            {
+                entities::Arena::current().release(entity);
+            }
+            for (auto&& entity : m_stack.top().entitiesRemoved)
+            {
+                entities::Arena::current().release(entity);
+            }
             m_stack.pop();
         }
         // Now, the only remaining frame left on the stack is the initial set of
         // entities, let's restore them.
         // The reason for cloning them while adding, is that we always need to keep
-        // live entities separate from saved state entities
+        // live entities separate from saved state entities, and the surface owns its
+        // own copies, which go back to the arena before being replaced.
+        for (auto&& [id, entity] : m_surface)
+        {
+            entities::Arena::current().release(entity);
+        }
         m_surface.clear();
         for (auto&& [id, entity] : m_stack.top().entitiesNew)
         {
             funcAddEntity(entity->clone());
-            m_surface.insert({ id, entity });
+            m_surface.insert({ id, entity->clone() });
         }
 
         m_entitiesRemoved.clear();
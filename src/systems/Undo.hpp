@@ -46,6 +46,8 @@ namespace systems
         void shutdown() override;
 
         void signalStateChange() { m_takeSnapshot = true; }
+        void signalUndo() { m_performUndo = true; }
+        void signalReset() { m_performReset = true; }
 
       protected:
         virtual bool isInterested(const entities::EntityPtr& entity) override;
@@ -70,7 +72,7 @@ namespace systems
         bool m_performUndo{ false };
         bool m_takeSnapshot{ false };
         bool m_performReset{ false };
-        entities::EntityVector m_entitiesRemoved;
+        std::vector<entities::Entity::IdType> m_entitiesRemoved;
         std::optional<std::uint32_t> m_keyboardUndoHandlerId{ 0 };
         std::optional<std::uint32_t> m_keyboardResetHandlerId{ 0 };
         std::optional<std::uint32_t> m_controllerUndoHandlerId{ 0 };
@@ -1,9 +1,13 @@
 #include "PhraseSearch.hpp"
 
 #include "components/Position.hpp"
+#include "services/ThreadPool.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <ranges>
+#include <type_traits>
 
 namespace systems::parser
 {
@@ -38,12 +42,15 @@ namespace systems::parser
 
         // Step 1: Find all groups of words
         // This performs top to bottom, left to right search.  It searches row by row, to find
-        // the start of a group, then collects the group, sorts the group by location and then
-        // phrases are parsed from each group.
-        for (misc::HexCoord::Type r = 0; r < level.getHeight(); r++)
-        {
-            for (misc::HexCoord::Type q = 0; q < level.getWidth(); q++)
+        // the start of a group, then collects the group and sorts the group by location.  Only
+        // the cells known to hold text are visited, the occupancy index is row major, so the
+        // search order is unchanged.
+        std::vector<entities::EntityVector> groups;
+        level.getOccupancy(Level::Occupancy::Text).forEach(
+            [&](std::size_t index)
             {
+                auto q = static_cast<misc::HexCoord::Type>(index % level.getWidth());
+                auto r = static_cast<misc::HexCoord::Type>(index / level.getWidth());
                 auto position = misc::HexCoord{ q, r };
                 if (!m_visited[r][q] && getTextCount(level, position) == 1)
                 {
@@ -51,39 +58,64 @@ namespace systems::parser
                     collectGroup(level, position, group);
                     sortGroupByLocation(group);
 
-                    // Place the words from these entities into our gridWords
+                    // Place the words from these entities into our gridWords.  Every word next to
+                    // a word of this group is part of it, so the groups never see each other's words.
                     for (auto&& entity : group)
                     {
                         auto location = entity->getComponent<components::Position>()->get();
                         m_gridWords[location.r][location.q] = entity->getComponent<components::Object>()->getText();
                     }
+                    groups.push_back(std::move(group));
+                }
+            });
 
-                    // Step 2: Find all phrase start words
-                    for (auto&& entity : group)
+        // Steps 2 & 3: The groups are independent, so they are searched in parallel.  A group
+        // only records phrase directions in its own cells, each with its own phrase ids (from 0).
+        std::vector<GroupSearch> groupSearches(groups.size());
+        ThreadPool::instance().parallelFor(
+            groups.size(),
+            [&](std::size_t index)
+            {
+                // Step 2: Find all phrase start words
+                for (auto&& entity : groups[index])
+                {
+                    // Step 3: Using these start words, begin the search for valid phrases in the groups
+                    auto location = entity->getComponent<components::Position>()->get();
+                    if (isStartWord(location))
                     {
-                        // Step 3: Using these start words, begin the search for valid phrases in the groups
-                        auto location = entity->getComponent<components::Position>()->get();
-                        if (isStartWord(location))
-                        {
-                            std::deque<Parser::PhrasePair> currentPhrase;
-                            std::unordered_set<misc::HexCoord> visitedGroup;
+                        std::deque<Parser::PhrasePair> currentPhrase;
+                        std::unordered_set<misc::HexCoord> visitedGroup;
 
-                            findPhrases(currentPhrase, location, level, gridDirection, visitedGroup);
-                        }
+                        findPhrases(currentPhrase, location, level, gridDirection, visitedGroup, groupSearches[index]);
                     }
+                }
+            });
 
-                    // Return the gridWords back to its original (blank) state
-                    for (auto&& entity : group)
+        // Step 4: Merge the results in group order, numbering the phrase ids following on
+        // from the previous groups, so they are the same as searching one group at a time.
+        std::vector<std::deque<Parser::PhrasePair>> phrases;
+        std::uint16_t nextPhraseId{ 0 };
+        for (std::size_t index = 0; index < groups.size(); index++)
+        {
+            if (nextPhraseId > 0 && groupSearches[index].nextPhraseId > 0)
+            {
+                for (auto&& entity : groups[index])
+                {
+                    auto location = entity->getComponent<components::Position>()->get();
+                    auto& directions = gridDirection[location.r][location.q];
+                    std::remove_reference_t<decltype(directions)> renumbered;
+                    for (auto&& [phraseId, direction] : directions)
                     {
-                        auto location = entity->getComponent<components::Position>()->get();
-                        m_gridWords[location.r][location.q] = components::TextType::None;
+                        renumbered.insert({ static_cast<std::uint16_t>(phraseId + nextPhraseId), direction });
                     }
+                    directions = std::move(renumbered);
                 }
             }
+            std::ranges::move(groupSearches[index].phrases, std::back_inserter(phrases));
+            nextPhraseId += groupSearches[index].nextPhraseId;
         }
 
-        // In theory, this should move, sure hope it does!
-        return m_phrases;
+        return phrases;
     }
 
     // ------------------------------------------------------------------
@@ -138,6 +170,10 @@ namespace systems::parser
     std::uint8_t PhraseSearch::getTextCount(const Level& level, const misc::HexCoord& position)
     {
         std::uint8_t count{ 0 };
+        if (!level.getOccupancy(Level::Occupancy::Text).test(level.toOccupancyIndex(position)))
+        {
+            return count;
+        }
 
         for (auto&& entity : level.getEntities(position) | std::views::values)
         {
@@ -166,7 +202,7 @@ namespace systems::parser
     //
     //
     // ------------------------------------------------------------------
-    void PhraseSearch::findPhrases(std::deque<Parser::PhrasePair> phrase, const misc::HexCoord& location, const Level& level, components::PhraseDirection::DirectionGrid& gridDirection, std::unordered_set<misc::HexCoord> visitedGroup)
+    void PhraseSearch::findPhrases(std::deque<Parser::PhrasePair> phrase, const misc::HexCoord& location, const Level& level, components::PhraseDirection::DirectionGrid& gridDirection, std::unordered_set<misc::HexCoord> visitedGroup, GroupSearch& groupSearch)
     {
         // Base case: Invalid grid location
         if (!location.isValid(level.getWidth(), level.getHeight()))
@@ -182,7 +218,7 @@ namespace systems::parser
         // Add this location's word to the phrase
         phrase.push_back({ m_gridWords[location.r][location.q], location });
 
-        auto parseResult = m_parser.parse(phrase);
+        auto parseResult = groupSearch.parser.parse(phrase);
         // Base case: Current phrase is invalid (not incomplete, but invalid)
         if (parseResult == Parser::ParseResult::Invalid)
         {
@@ -196,11 +232,11 @@ namespace systems::parser
             // record the directions used in this phrase
             for (std::size_t word = 1; word < phrase.size(); word++)
             {
-                gridDirection[phrase[word - 1].cell.r][phrase[word - 1].cell.q].insert({ m_nextPhraseId, { misc::HexCoord::getDirection(phrase[word - 1].cell, phrase[word].cell), phraseElement } });
+                gridDirection[phrase[word - 1].cell.r][phrase[word - 1].cell.q].insert({ groupSearch.nextPhraseId, { misc::HexCoord::getDirection(phrase[word - 1].cell, phrase[word].cell), phraseElement } });
                 phraseElement = (phraseElement == components::PhraseDirection::PhraseElement::Start) ? components::PhraseDirection::PhraseElement::Middle : phraseElement;
             }
-            m_phrases.push_back(phrase);
-            m_nextPhraseId++;
+            groupSearch.phrases.push_back(phrase);
+            groupSearch.nextPhraseId++;
         }
 
         // If this cell is a Noun or PropAbility, mark it as visited so it doesn't get considered again during this phrase search,
@@ -230,7 +266,7 @@ namespace systems::parser
             // Can't visit this neighbor if there is a phrase in the opposite direction already
             if (!hasPhraseDirection(neighbor, misc::HexCoord::getDirection(neighbor, location)))
             {
-                findPhrases(phrase, neighbor, level, gridDirection, visitedGroup);
+                findPhrases(phrase, neighbor, level, gridDirection, visitedGroup, groupSearch);
             }
         }
         neighbor = location.NE();
@@ -238,7 +274,7 @@ namespace systems::parser
         {
             if (!hasPhraseDirection(neighbor, misc::HexCoord::getDirection(neighbor, location)))
             {
-                findPhrases(phrase, neighbor, level, gridDirection, visitedGroup);
+                findPhrases(phrase, neighbor, level, gridDirection, visitedGroup, groupSearch);
             }
         }
         neighbor = location.SW();
@@ -246,7 +282,7 @@ namespace systems::parser
         {
             if (!hasPhraseDirection(neighbor, misc::HexCoord::getDirection(neighbor, location)))
             {
-                findPhrases(phrase, neighbor, level, gridDirection, visitedGroup);
+                findPhrases(phrase, neighbor, level, gridDirection, visitedGroup, groupSearch);
             }
         }
         neighbor = location.SE();
@@ -254,7 +290,7 @@ namespace systems::parser
         {
             if (!hasPhraseDirection(neighbor, misc::HexCoord::getDirection(neighbor, location)))
             {
-                findPhrases(phrase, neighbor, level, gridDirection, visitedGroup);
+                findPhrases(phrase, neighbor, level, gridDirection, visitedGroup, groupSearch);
             }
         }
         neighbor = location.W();
@@ -262,7 +298,7 @@ namespace systems::parser
         {
             if (!hasPhraseDirection(neighbor, misc::HexCoord::getDirection(neighbor, location)))
             {
-                findPhrases(phrase, neighbor, level, gridDirection, visitedGroup);
+                findPhrases(phrase, neighbor, level, gridDirection, visitedGroup, groupSearch);
             }
         }
         neighbor = location.E();
@@ -270,7 +306,7 @@ namespace systems::parser
         {
             if (!hasPhraseDirection(neighbor, misc::HexCoord::getDirection(neighbor, location)))
             {
-                findPhrases(phrase, neighbor, level, gridDirection, visitedGroup);
+                findPhrases(phrase, neighbor, level, gridDirection, visitedGroup, groupSearch);
             }
         }
     }
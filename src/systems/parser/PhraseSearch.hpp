@@ -20,9 +20,15 @@ namespace systems::parser
         std::vector<std::deque<Parser::PhrasePair>> search(const Level& level, components::PhraseDirection::DirectionGrid& gridDirection);
 
       private:
-        Parser m_parser{ false, false };
-        std::vector<std::deque<Parser::PhrasePair>> m_phrases;
-        std::uint16_t m_nextPhraseId{ 0 };
+        // The working state of the search through a single group of words.  Groups
+        // are searched independently, each one with its own.
+        struct GroupSearch
+        {
+            Parser parser{ false, false };
+            std::vector<std::deque<Parser::PhrasePair>> phrases;
+            std::uint16_t nextPhraseId{ 0 };
+        };
+
         // We use this array to know if we have visited the location during the recursive traversal
         // to find groups of words.
         std::vector<std::vector<bool>> m_visited;
@@ -33,7 +39,7 @@ namespace systems::parser
         void collectGroup(const Level& level, const misc::HexCoord& position, entities::EntityVector& group);
         std::uint8_t getTextCount(const Level& level, const misc::HexCoord& position);
         bool isStartWord(misc::HexCoord position);
-        void findPhrases(std::deque<Parser::PhrasePair> phrase, const misc::HexCoord& location, const Level& level, components::PhraseDirection::DirectionGrid& m_gridDirection, std::unordered_set<misc::HexCoord> visitedGroup);
+        void findPhrases(std::deque<Parser::PhrasePair> phrase, const misc::HexCoord& location, const Level& level, components::PhraseDirection::DirectionGrid& m_gridDirection, std::unordered_set<misc::HexCoord> visitedGroup, GroupSearch& groupSearch);
         void sortGroupByLocation(entities::EntityVector& group);
     };
 } // namespace systems::parser
\ No newline at end of file
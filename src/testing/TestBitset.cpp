@@ -0,0 +1,132 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "misc/Bitset.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(Bitset, SetResetTest)
+{
+    misc::Bitset bits(130);
+
+    EXPECT_EQ(bits.size(), 130);
+    EXPECT_FALSE(bits.any());
+
+    bits.set(0);
+    bits.set(63);
+    bits.set(64);
+    bits.set(129);
+    EXPECT_TRUE(bits.test(0));
+    EXPECT_TRUE(bits.test(63));
+    EXPECT_TRUE(bits.test(64));
+    EXPECT_TRUE(bits.test(129));
+    EXPECT_FALSE(bits.test(1));
+    EXPECT_EQ(bits.count(), 4);
+
+    bits.reset(63);
+    EXPECT_FALSE(bits.test(63));
+    EXPECT_EQ(bits.count(), 3);
+
+    bits.reset();
+    EXPECT_FALSE(bits.any());
+}
+
+TEST(Bitset, ForEachInOrder)
+{
+    misc::Bitset bits(200);
+    std::vector<std::size_t> expected{ 1, 5, 64, 127, 128, 199 };
+    for (auto bit : expected)
+    {
+        bits.set(bit);
+    }
+
+    std::vector<std::size_t> found;
+    bits.forEach([&found](std::size_t bit)
+                 {
+                     found.push_back(bit);
+                 });
+
+    EXPECT_EQ(found, expected);
+}
+
+TEST(Bitset, ForEachInRange)
+{
+    misc::Bitset bits(200);
+    for (auto bit : { 1, 5, 64, 127, 128, 199 })
+    {
+        bits.set(bit);
+    }
+
+    std::vector<std::size_t> found;
+    bits.forEach(5, 128, [&found](std::size_t bit)
+                 {
+                     found.push_back(bit);
+                 });
+    EXPECT_EQ(found, (std::vector<std::size_t>{ 5, 64, 127 }));
+
+    found.clear();
+    bits.forEach(2, 5, [&found](std::size_t bit)
+                 {
+                     found.push_back(bit);
+                 });
+    EXPECT_TRUE(found.empty());
+
+    found.clear();
+    bits.forEach(128, 200, [&found](std::size_t bit)
+                 {
+                     found.push_back(bit);
+                 });
+    EXPECT_EQ(found, (std::vector<std::size_t>{ 128, 199 }));
+}
+
+TEST(Bitset, XorFindsChanges)
+{
+    misc::Bitset previous(100);
+    misc::Bitset current(100);
+    previous.set(3);
+    previous.set(70);
+    current.set(3);
+    current.set(90);
+
+    auto changed = previous ^ current;
+    EXPECT_EQ(changed.count(), 2);
+    EXPECT_TRUE(changed.test(70));
+    EXPECT_TRUE(changed.test(90));
+    EXPECT_FALSE(changed.test(3));
+
+    EXPECT_FALSE(previous == current);
+    current.reset(90);
+    current.set(70);
+    EXPECT_TRUE(previous == current);
+}
+
+TEST(Bitset, ResizeClearsTrailingBits)
+{
+    misc::Bitset bits(100);
+    bits.set(80);
+    bits.resize(70);
+    bits.resize(100);
+
+    EXPECT_FALSE(bits.test(80));
+    EXPECT_FALSE(bits.any());
+}
@@ -22,8 +22,12 @@ THE SOFTWARE.
 
 #include "../services/concurrency/ConcurrentQueue.hpp"
 
+#include <chrono>
 #include <gtest/gtest.h>
+#include <iostream>
 #include <string>
+#include <thread>
+#include <vector>
 
 TEST(ConcurrentQueue, Integerals)
 {
@@ -100,3 +104,146 @@ TEST(ConcurrentQueue, Strings)
 
     EXPECT_FALSE(queue.dequeue().has_value());
 }
+
+TEST(ConcurrentQueue, RingOverflowKeepsOrder)
+{
+    ConcurrentQueue<int, 4> queue;
+
+    for (int value = 0; value < 10; value++)
+    {
+        queue.enqueue(value);
+    }
+    EXPECT_EQ(queue.size(), 10u);
+
+    // Wrapping around the end of the ring, with part of the group spilling over
+    queue.enqueue(std::vector<int>{ 10, 11, 12 });
+    EXPECT_EQ(queue.size(), 13u);
+
+    for (int value = 0; value < 13; value++)
+    {
+        EXPECT_EQ(queue.dequeue().value(), value);
+    }
+    EXPECT_FALSE(queue.dequeue().has_value());
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(ConcurrentQueue, DequeueBulkAcrossRingAndOverflow)
+{
+    ConcurrentQueue<int, 4> queue;
+
+    EXPECT_EQ(queue.dequeueBulk(10, [](int) {}), 0u);
+    for (int value = 0; value < 10; value++)
+    {
+        queue.enqueue(value);
+    }
+    EXPECT_EQ(queue.sizeApprox(), 10u);
+
+    // The first call stops within the ring, the second takes the rest of the ring and the overflow
+    std::vector<int> items;
+    EXPECT_EQ(queue.dequeueBulk(items, 3), 3u);
+    EXPECT_EQ(queue.dequeueBulk(items, 20), 7u);
+    EXPECT_EQ(items, (std::vector<int>{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+    EXPECT_EQ(queue.sizeApprox(), 0u);
+    EXPECT_FALSE(queue.dequeue().has_value());
+}
+
+TEST(ConcurrentQueue, WithoutRing)
+{
+    ConcurrentQueue<int, 0> queue;
+
+    queue.enqueue(1);
+    queue.enqueue(std::vector<int>{ 2, 3, 4 });
+    EXPECT_EQ(queue.sizeApprox(), 4u);
+    EXPECT_EQ(queue.dequeue().value(), 1);
+
+    std::vector<int> items;
+    EXPECT_EQ(queue.dequeueBulk(items, 10), 3u);
+    EXPECT_EQ(items, (std::vector<int>{ 2, 3, 4 }));
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+namespace
+{
+    // --------------------------------------------------------------
+    //
+    // Each producer enqueues its share of the items, while the consumers
+    // dequeue until all of them have been seen.  Returns the elapsed time,
+    // and checks every item arrived exactly once, by summing them.
+    //
+    // --------------------------------------------------------------
+    template <typename Queue>
+    std::chrono::microseconds runContention(Queue& queue, std::size_t producers, std::size_t consumers, std::size_t itemsPerProducer)
+    {
+        const std::size_t total = producers * itemsPerProducer;
+        std::atomic_size_t consumed{ 0 };
+        std::atomic_uint64_t sum{ 0 };
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (std::size_t producer = 0; producer < producers; producer++)
+        {
+            threads.emplace_back([&queue, producer, itemsPerProducer]()
+                                 {
+                                     for (std::size_t item = 0; item < itemsPerProducer; item++)
+                                     {
+                                         queue.enqueue(producer * itemsPerProducer + item);
+                                     }
+                                 });
+        }
+        for (std::size_t consumer = 0; consumer < consumers; consumer++)
+        {
+            threads.emplace_back([&queue, &consumed, &sum, total]()
+                                 {
+                                     while (consumed.load() < total)
+                                     {
+                                         if (auto item = queue.dequeue())
+                                         {
+                                             sum += item.value();
+                                             consumed++;
+                                         }
+                                         else
+                                         {
+                                             std::this_thread::yield();
+                                         }
+                                     }
+                                 });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        EXPECT_EQ(sum.load(), static_cast<std::uint64_t>(total) * (total - 1) / 2);
+        return elapsed;
+    }
+} // namespace
+
+// --------------------------------------------------------------
+//
+// Not a pass/fail on the timing, that depends on the machine, it
+// reports the throughput of the default queue, with the ring in
+// front, and the one that is only a deque behind a mutex.  Disabled,
+// run it with --gtest_also_run_disabled_tests.
+//
+// --------------------------------------------------------------
+TEST(ConcurrentQueue, DISABLED_ContentionBenchmark)
+{
+    const std::size_t ITEMS_PER_PRODUCER{ 100'000 };
+
+    for (auto [producers, consumers] : { std::pair<std::size_t, std::size_t>{ 1, 1 }, { 2, 2 }, { 4, 4 } })
+    {
+        ConcurrentQueue<std::uint64_t, 0> locked;
+        ConcurrentQueue<std::uint64_t> lockFree;
+
+        auto timeLocked = runContention(locked, producers, consumers, ITEMS_PER_PRODUCER);
+        auto timeLockFree = runContention(lockFree, producers, consumers, ITEMS_PER_PRODUCER);
+
+        auto itemsPerMs = [&](std::chrono::microseconds elapsed)
+        {
+            return producers * ITEMS_PER_PRODUCER * 1000 / std::max<std::int64_t>(1, elapsed.count());
+        };
+        std::cout << producers << " producers x " << consumers << " consumers: locked " << itemsPerMs(timeLocked)
+                  << " items/ms, lock-free " << itemsPerMs(timeLockFree) << " items/ms" << std::endl;
+    }
+}
@@ -0,0 +1,108 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "misc/ContentArchive.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+
+namespace
+{
+    std::string toString(std::span<const std::byte> data)
+    {
+        return std::string(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    void writeFile(const std::filesystem::path& path, const std::string& contents)
+    {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream out(path, std::ios::binary);
+        out << contents;
+    }
+} // namespace
+
+TEST(ContentArchive, PackAndFind)
+{
+    auto folder = std::filesystem::temp_directory_path() / "tms-content-archive";
+    auto archiveFile = std::filesystem::temp_directory_path() / "tms-content-archive.pack";
+    std::filesystem::remove_all(folder);
+    writeFile(folder / "images" / "hex.png", "hex image data");
+    writeFile(folder / "audio" / "step.ogg", "step sound");
+    writeFile(folder / "fonts" / "empty.ttf", "");
+
+    EXPECT_TRUE(misc::ContentArchive::pack(folder, archiveFile));
+
+    misc::ContentArchive archive;
+    EXPECT_TRUE(archive.open(archiveFile));
+    EXPECT_EQ(archive.size(), 3u);
+    EXPECT_EQ(toString(archive.find("images/hex.png").value()), "hex image data");
+    EXPECT_EQ(toString(archive.find("audio/step.ogg").value()), "step sound");
+    EXPECT_EQ(archive.find("fonts/empty.ttf").value().size(), 0u);
+    EXPECT_FALSE(archive.find("images/missing.png").has_value());
+
+    archive.close();
+    EXPECT_FALSE(archive.isOpen());
+    std::filesystem::remove_all(folder);
+    std::filesystem::remove(archiveFile);
+}
+
+TEST(ContentArchive, RejectsDamagedArchive)
+{
+    auto archiveFile = std::filesystem::temp_directory_path() / "tms-content-archive-damaged.pack";
+    writeFile(archiveFile, "TMSA not really an archive");
+
+    misc::ContentArchive archive;
+    EXPECT_FALSE(archive.open(archiveFile));
+    EXPECT_FALSE(archive.isOpen());
+    EXPECT_FALSE(archive.open(std::filesystem::temp_directory_path() / "tms-does-not-exist.pack"));
+
+    std::filesystem::remove(archiveFile);
+}
+
+TEST(ContentArchive, RejectsEntryPastTheEnd)
+{
+    auto archiveFile = std::filesystem::temp_directory_path() / "tms-content-archive-overflow.pack";
+
+    // A single entry whose start + size wraps around to land inside the file
+    std::string contents{ "TMSA" };
+    auto append = [&contents](auto value)
+    {
+        contents.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    append(std::uint32_t{ 1 });
+    append(std::uint32_t{ 1 });
+    append(std::uint16_t{ 1 });
+    contents += "a";
+    append(std::uint64_t{ 8 });
+    append(std::numeric_limits<std::uint64_t>::max() - 4);
+    writeFile(archiveFile, contents);
+
+    misc::ContentArchive archive;
+    EXPECT_FALSE(archive.open(archiveFile));
+
+    std::filesystem::remove(archiveFile);
+}
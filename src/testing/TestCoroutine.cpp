@@ -0,0 +1,101 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "services/concurrency/Coroutine.hpp"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    coro::Task<int> square(int value)
+    {
+        co_await coro::scheduleOn(coro::Executor::Frame);
+        co_return value * value;
+    }
+
+    coro::Task<int> sumOfSquares(int count)
+    {
+        std::vector<coro::Task<int>> tasks;
+        for (int value = 1; value <= count; value++)
+        {
+            tasks.push_back(square(value));
+        }
+
+        int total{ 0 };
+        for (auto result : co_await coro::whenAll(std::move(tasks)))
+        {
+            total += result;
+        }
+        co_return total;
+    }
+
+    coro::Task<std::thread::id> threadOf(coro::Executor executor)
+    {
+        co_await coro::scheduleOn(executor);
+        co_return std::this_thread::get_id();
+    }
+
+    coro::Task<> fails()
+    {
+        co_await coro::scheduleOn(coro::Executor::Background);
+        throw std::runtime_error("failed");
+    }
+} // namespace
+
+TEST(Coroutine, AwaitsResults)
+{
+    EXPECT_EQ(coro::syncWait(square(7)), 49);
+    EXPECT_EQ(coro::syncWait(sumOfSquares(10)), 385);
+}
+
+TEST(Coroutine, ResumesOnExecutor)
+{
+    EXPECT_NE(coro::syncWait(threadOf(coro::Executor::IO)), std::this_thread::get_id());
+    EXPECT_NE(coro::syncWait(threadOf(coro::Executor::Background)), std::this_thread::get_id());
+}
+
+TEST(Coroutine, ResumesOnMain)
+{
+    std::thread::id resumedOn;
+    auto task = [](std::thread::id& resumedOn) -> coro::Task<>
+    {
+        co_await coro::scheduleOn(coro::Executor::Main);
+        resumedOn = std::this_thread::get_id();
+    };
+    coro::start(task(resumedOn));
+    EXPECT_EQ(resumedOn, std::thread::id{});
+
+    coro::processMain();
+    EXPECT_EQ(resumedOn, std::this_thread::get_id());
+}
+
+TEST(Coroutine, PropagatesExceptions)
+{
+    EXPECT_THROW(coro::syncWait(fails()), std::runtime_error);
+
+    std::vector<coro::Task<>> tasks;
+    tasks.push_back(fails());
+    EXPECT_THROW(coro::syncWait(coro::whenAll(std::move(tasks))), std::runtime_error);
+}
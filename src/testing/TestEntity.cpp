@@ -0,0 +1,147 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "components/Position.hpp"
+#include "entities/Entity.hpp"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <unordered_set>
+
+TEST(EntityArena, CreateAndResolve)
+{
+    entities::Arena arena;
+
+    auto entity = entities::create();
+    entity->addComponent(std::make_unique<components::Position>(misc::HexCoord{ 2, 3 }));
+
+    EXPECT_EQ(arena.size(), 1);
+    EXPECT_TRUE(entity);
+    EXPECT_TRUE(entity->hasComponent<components::Position>());
+    EXPECT_EQ(entity->getComponent<components::Position>()->get(), (misc::HexCoord{ 2, 3 }));
+
+    entities::EntityPtr none;
+    EXPECT_FALSE(none);
+    EXPECT_TRUE(none == nullptr);
+    EXPECT_EQ(none.get(), nullptr);
+}
+
+TEST(EntityArena, ReleasedHandleNoLongerResolves)
+{
+    entities::Arena arena;
+
+    auto first = entities::create();
+    auto copy = first;
+    arena.release(first);
+
+    EXPECT_EQ(arena.size(), 0);
+    EXPECT_FALSE(first);
+    EXPECT_FALSE(copy);
+
+    // The slot is reused, but with a new generation, the old handle stays dead
+    auto second = entities::create();
+    EXPECT_TRUE(second);
+    EXPECT_NE(first, second);
+    EXPECT_FALSE(first);
+
+    // Releasing a handle that no longer resolves does nothing
+    arena.release(first);
+    EXPECT_EQ(arena.size(), 1);
+    EXPECT_TRUE(second);
+
+    // Using a handle that no longer resolves fails every time, not just in debug
+    EXPECT_THROW(first->getId(), std::logic_error);
+    EXPECT_THROW(*first, std::logic_error);
+}
+
+TEST(EntityArena, ReleasedSlotsReusedOldestFirst)
+{
+    entities::Arena arena;
+
+    auto first = entities::create();
+    auto second = entities::create();
+    arena.release(first);
+    arena.release(second);
+
+    // The slot released first is reused first, so a just released handle is the last to be aliased
+    auto third = entities::create();
+    auto fourth = entities::create();
+    EXPECT_EQ(third.getHandle() & 0xffffffff, first.getHandle() & 0xffffffff);
+    EXPECT_EQ(fourth.getHandle() & 0xffffffff, second.getHandle() & 0xffffffff);
+    EXPECT_FALSE(first);
+    EXPECT_FALSE(second);
+    EXPECT_TRUE(third);
+    EXPECT_TRUE(fourth);
+}
+
+TEST(EntityArena, NestedArenaRestoresPrevious)
+{
+    entities::Arena outer;
+    auto entity = entities::create();
+    {
+        entities::Arena inner;
+        EXPECT_EQ(&entities::Arena::current(), &inner);
+        entities::create();
+        EXPECT_EQ(inner.size(), 1);
+    }
+    EXPECT_EQ(&entities::Arena::current(), &outer);
+    EXPECT_EQ(outer.size(), 1);
+    EXPECT_TRUE(entity);
+}
+
+TEST(EntityArena, ManyChunks)
+{
+    entities::Arena arena;
+
+    std::vector<entities::EntityPtr> entities;
+    for (auto i = 0; i < 5000; i++)
+    {
+        entities.push_back(entities::create());
+    }
+    EXPECT_EQ(arena.size(), 5000);
+
+    std::unordered_set<entities::EntityPtr> unique(entities.begin(), entities.end());
+    EXPECT_EQ(unique.size(), entities.size());
+
+    std::unordered_set<entities::Entity::IdType> ids;
+    for (auto&& entity : entities)
+    {
+        ids.insert(entity->getId());
+    }
+    EXPECT_EQ(ids.size(), entities.size());
+}
+
+TEST(EntityArena, CloneIsSeparateEntity)
+{
+    entities::Arena arena;
+
+    auto entity = entities::create();
+    entity->addComponent(std::make_unique<components::Position>(misc::HexCoord{ 1, 1 }));
+    auto clone = entity->clone();
+
+    EXPECT_NE(entity, clone);
+    EXPECT_EQ(entity->getId(), clone->getId());
+    EXPECT_TRUE(*entity == *clone);
+
+    clone->getComponent<components::Position>()->set(misc::HexCoord{ 4, 4 });
+    EXPECT_TRUE(*entity != *clone);
+}
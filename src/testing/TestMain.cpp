@@ -20,10 +20,31 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 THE SOFTWARE.
 */
 
+#include "entities/Entity.hpp"
+
 #include <gtest/gtest.h>
+#include <memory>
+
+// --------------------------------------------------------------
+//
+// Entities are always created from the current arena, so every test
+// gets a default one.  Tests that need to check on the arena itself
+// make their own, which is current for as long as it is in scope.
+//
+// --------------------------------------------------------------
+class ArenaEnvironment : public testing::Environment
+{
+  public:
+    void SetUp() override { m_arena = std::make_unique<entities::Arena>(); }
+    void TearDown() override { m_arena.reset(); }
+
+  private:
+    std::unique_ptr<entities::Arena> m_arena;
+};
 
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
+    testing::AddGlobalTestEnvironment(new ArenaEnvironment());
     return RUN_ALL_TESTS();
 }
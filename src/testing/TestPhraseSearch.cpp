@@ -122,9 +122,8 @@ void loadContent()
 
     Content::load<Levels>(content::KEY_LEVELS, "levels-unittests.puzzles", nullptr, nullptr);
 
-    // Busy wait for the content to finish loading.  It's okay, it happens super fast first time level is started
-    while (Content::instance().anyPending())
-        ;
+    // Wait for the content to finish loading.  It's okay, it happens super fast first time level is started
+    Content::instance().waitUntilLoaded();
 }
 
 bool containsPhrase(std::vector<std::deque<systems::parser::Parser::PhrasePair>>& phrases, std::deque<components::TextType>& phrase)
@@ -0,0 +1,85 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "components/Position.hpp"
+#include "components/Property.hpp"
+#include "entities/Entity.hpp"
+#include "systems/Query.hpp"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    entities::EntityPtr makeEntity(components::PropertyType property)
+    {
+        auto entity = entities::create();
+        entity->addComponent(std::make_unique<components::Position>(misc::HexCoord{ 0, 0 }));
+        entity->addComponent(std::make_unique<components::Property>(property));
+        return entity;
+    }
+} // namespace
+
+TEST(Query, MatchesComponentsAndProperties)
+{
+    auto goals = systems::Query().with<components::Position>().with(components::PropertyType::Goal);
+    auto unplaced = systems::Query().with<components::Property>().without<components::Position>();
+
+    auto goal = makeEntity(components::PropertyType::Goal);
+    auto stop = makeEntity(components::PropertyType::Stop);
+
+    EXPECT_TRUE(goals.matches(goal));
+    EXPECT_FALSE(goals.matches(stop));
+    EXPECT_FALSE(unplaced.matches(goal));
+}
+
+TEST(Query, KeepsMatchesUpToDate)
+{
+    auto query = systems::Query().with(components::PropertyType::Goal);
+    auto first = makeEntity(components::PropertyType::Goal);
+    auto second = makeEntity(components::PropertyType::Goal);
+    auto third = makeEntity(components::PropertyType::Stop);
+
+    query.add(first);
+    query.add(second);
+    query.add(third);
+    query.add(first);
+    EXPECT_EQ(query.size(), 2);
+    EXPECT_TRUE(query.contains(first->getId()));
+    EXPECT_FALSE(query.contains(third->getId()));
+
+    // Changing the property moves entities in and out of the query
+    third->getComponent<components::Property>()->add(components::PropertyType::Goal);
+    query.update(third);
+    first->getComponent<components::Property>()->remove(components::PropertyType::Goal);
+    query.update(first);
+    EXPECT_EQ(query.size(), 2);
+    EXPECT_FALSE(query.contains(first->getId()));
+    EXPECT_TRUE(query.contains(third->getId()));
+
+    query.remove(second->getId());
+    ASSERT_EQ(query.size(), 1);
+    EXPECT_EQ(*query.begin(), third);
+
+    query.clear();
+    EXPECT_TRUE(query.empty());
+}
@@ -0,0 +1,157 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "services/Replay.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // A replay file with a valid header, followed by whatever is in body
+    void writeReplay(const std::filesystem::path& filename, const std::vector<std::uint8_t>& body)
+    {
+        std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+        const std::string uuid{ "level-uuid" };
+        const std::uint16_t version{ 1 };
+        const auto length = static_cast<std::uint16_t>(uuid.size());
+
+        out.write("TMSR", 4);
+        out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        out.write(uuid.data(), uuid.size());
+        out.write(reinterpret_cast<const char*>(body.data()), body.size());
+    }
+} // namespace
+
+TEST(Replay, RecordAndPlayback)
+{
+    auto filename = std::filesystem::temp_directory_path() / "tms-test.replay";
+
+    Replay::instance().startRecording("level-uuid");
+    Replay::instance().beginFrame(std::chrono::microseconds(16667));
+    Replay::instance().record(Replay::Action::Move, 3);
+    Replay::instance().beginFrame(std::chrono::microseconds(5));
+    Replay::instance().beginFrame(std::chrono::microseconds(1000000));
+    Replay::instance().record(Replay::Action::MoveWithPull, 1);
+    Replay::instance().record(Replay::Action::Undo);
+    Replay::instance().record(Replay::Action::Camera, 4);
+    EXPECT_TRUE(Replay::instance().stopRecording(filename));
+
+    // Once recording stops, nothing more is recorded
+    Replay::instance().record(Replay::Action::Reset);
+
+    EXPECT_TRUE(Replay::instance().startPlayback(filename));
+    EXPECT_EQ(Replay::instance().getLevelUUID(), "level-uuid");
+
+    auto frame = Replay::instance().nextFrame();
+    EXPECT_EQ(frame->elapsedTime, std::chrono::microseconds(16667));
+    EXPECT_EQ(frame->events, (std::vector<Replay::Event>{ { Replay::Action::Move, 3 } }));
+
+    frame = Replay::instance().nextFrame();
+    EXPECT_EQ(frame->elapsedTime, std::chrono::microseconds(5));
+    EXPECT_TRUE(frame->events.empty());
+
+    frame = Replay::instance().nextFrame();
+    EXPECT_EQ(frame->elapsedTime, std::chrono::microseconds(1000000));
+    EXPECT_EQ(frame->events, (std::vector<Replay::Event>{ { Replay::Action::MoveWithPull, 1 }, { Replay::Action::Undo, 0 }, { Replay::Action::Camera, 4 } }));
+
+    EXPECT_FALSE(Replay::instance().nextFrame().has_value());
+    Replay::instance().stopPlayback();
+    EXPECT_FALSE(Replay::instance().isPlaying());
+
+    std::filesystem::remove(filename);
+}
+
+TEST(Replay, RejectsMissingFile)
+{
+    EXPECT_FALSE(Replay::instance().startPlayback(std::filesystem::temp_directory_path() / "tms-does-not-exist.replay"));
+    EXPECT_FALSE(Replay::instance().isPlaying());
+}
+
+TEST(Replay, RejectsFrameCountLargerThanFile)
+{
+    auto filename = std::filesystem::temp_directory_path() / "tms-test-count.replay";
+    writeReplay(filename, { 0xff, 0xff, 0xff, 0xff, 0x10, 0x00 });
+
+    EXPECT_FALSE(Replay::instance().startPlayback(filename));
+    EXPECT_FALSE(Replay::instance().isPlaying());
+
+    std::filesystem::remove(filename);
+}
+
+TEST(Replay, RejectsOutOfRangeEvents)
+{
+    auto filename = std::filesystem::temp_directory_path() / "tms-test-events.replay";
+
+    // Frame count of 1, elapsed time of 16, one event
+    writeReplay(filename, { 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x05 });
+    EXPECT_TRUE(Replay::instance().startPlayback(filename));
+    Replay::instance().stopPlayback();
+
+    // A direction past the last one
+    writeReplay(filename, { 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x06 });
+    EXPECT_FALSE(Replay::instance().startPlayback(filename));
+
+    // A camera input past the last one
+    writeReplay(filename, { 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x04, 0x06 });
+    EXPECT_FALSE(Replay::instance().startPlayback(filename));
+
+    // An action that doesn't exist
+    writeReplay(filename, { 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x05, 0x00 });
+    EXPECT_FALSE(Replay::instance().startPlayback(filename));
+    EXPECT_FALSE(Replay::instance().isPlaying());
+
+    std::filesystem::remove(filename);
+}
+
+TEST(Replay, RejectsTruncatedFile)
+{
+    auto filename = std::filesystem::temp_directory_path() / "tms-test-truncated.replay";
+
+    // The level uuid is cut short
+    {
+        std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+        const std::uint16_t version{ 1 };
+        const std::uint16_t length{ 10 };
+
+        out.write("TMSR", 4);
+        out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        out.write("lev", 3);
+    }
+    EXPECT_FALSE(Replay::instance().startPlayback(filename));
+    EXPECT_TRUE(Replay::instance().getLevelUUID().empty());
+
+    // Frame count of 1, elapsed time of 16, two events that aren't there
+    writeReplay(filename, { 0x01, 0x00, 0x00, 0x00, 0x10, 0x02 });
+    EXPECT_FALSE(Replay::instance().startPlayback(filename));
+    EXPECT_TRUE(Replay::instance().getLevelUUID().empty());
+    EXPECT_FALSE(Replay::instance().isPlaying());
+
+    std::filesystem::remove(filename);
+}
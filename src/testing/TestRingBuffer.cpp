@@ -0,0 +1,194 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "../services/concurrency/RingBuffer.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+TEST(RingBuffer, FillAndDrain)
+{
+    RingBuffer<int, 4> buffer;
+
+    EXPECT_FALSE(buffer.dequeue().has_value());
+
+    EXPECT_TRUE(buffer.enqueue(1));
+    EXPECT_TRUE(buffer.enqueue(2));
+    EXPECT_TRUE(buffer.enqueue(3));
+    EXPECT_TRUE(buffer.enqueue(4));
+    EXPECT_FALSE(buffer.enqueue(5));
+
+    EXPECT_EQ(buffer.dequeue().value(), 1);
+    EXPECT_EQ(buffer.dequeue().value(), 2);
+    EXPECT_TRUE(buffer.enqueue(6));
+    EXPECT_EQ(buffer.dequeue().value(), 3);
+    EXPECT_EQ(buffer.dequeue().value(), 4);
+    EXPECT_EQ(buffer.dequeue().value(), 6);
+
+    EXPECT_FALSE(buffer.dequeue().has_value());
+}
+
+TEST(RingBuffer, MultipleProducers)
+{
+    static constexpr int PRODUCERS = 4;
+    static constexpr int PER_PRODUCER = 10000;
+    RingBuffer<int, 1024> buffer;
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < PRODUCERS; producer++)
+    {
+        producers.emplace_back(
+            [&buffer, producer]()
+            {
+                for (int i = 0; i < PER_PRODUCER; i++)
+                {
+                    while (!buffer.enqueue(producer * PER_PRODUCER + i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+
+    // Every item must arrive exactly once and in order for each producer
+    std::vector<int> next(PRODUCERS, 0);
+    int received{ 0 };
+    while (received < PRODUCERS * PER_PRODUCER)
+    {
+        if (auto item = buffer.dequeue())
+        {
+            auto producer = item.value() / PER_PRODUCER;
+            EXPECT_EQ(item.value() % PER_PRODUCER, next[producer]);
+            next[producer]++;
+            received++;
+        }
+    }
+    for (auto&& producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_FALSE(buffer.dequeue().has_value());
+}
+
+TEST(RingBuffer, Bulk)
+{
+    RingBuffer<int, 8> buffer;
+    std::vector<int> items(12);
+    std::iota(items.begin(), items.end(), 0);
+
+    EXPECT_EQ(buffer.enqueueBulk(items.data(), items.size()), 8u);
+    EXPECT_EQ(buffer.enqueueBulk(items.data(), items.size()), 0u);
+    EXPECT_EQ(buffer.sizeApprox(), 8u);
+
+    std::vector<int> taken;
+    EXPECT_EQ(buffer.dequeueBulk(taken, 5), 5u);
+    EXPECT_EQ(buffer.dequeueBulk(taken, 5), 3u);
+    EXPECT_EQ(taken, std::vector<int>(items.begin(), items.begin() + 8));
+    EXPECT_EQ(buffer.dequeueBulk(taken, 5), 0u);
+    EXPECT_EQ(buffer.sizeApprox(), 0u);
+}
+
+TEST(RingBuffer, ItemsAreConstructedAndDestroyedInPlace)
+{
+    // No default constructor, and it owns something, so a slot that keeps it around would show up in the use count
+    struct Item
+    {
+        explicit Item(std::shared_ptr<int> value) :
+            value(std::move(value))
+        {
+        }
+        std::shared_ptr<int> value;
+    };
+    auto shared = std::make_shared<int>(1);
+
+    {
+        RingBuffer<Item, 4> buffer;
+        EXPECT_TRUE(buffer.enqueue(Item(shared)));
+        EXPECT_TRUE(buffer.enqueue(Item(shared)));
+        EXPECT_EQ(shared.use_count(), 3);
+
+        EXPECT_EQ(buffer.dequeue().value().value, shared);
+        EXPECT_EQ(shared.use_count(), 2);
+    }
+    // The item still in the buffer goes away with it
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(RingBuffer, MultipleProducersAndConsumers)
+{
+    static constexpr int PRODUCERS = 4;
+    static constexpr int CONSUMERS = 4;
+    static constexpr int PER_PRODUCER = 10000;
+    RingBuffer<int, 64> buffer;
+    std::atomic_int received{ 0 };
+    std::atomic<long long> sum{ 0 };
+
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < PRODUCERS; producer++)
+    {
+        threads.emplace_back(
+            [&buffer, producer]()
+            {
+                for (int i = 0; i < PER_PRODUCER; i++)
+                {
+                    while (!buffer.enqueue(producer * PER_PRODUCER + i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+    for (int consumer = 0; consumer < CONSUMERS; consumer++)
+    {
+        threads.emplace_back(
+            [&buffer, &received, &sum]()
+            {
+                while (received.load() < PRODUCERS * PER_PRODUCER)
+                {
+                    if (auto item = buffer.dequeue())
+                    {
+                        sum += item.value();
+                        received++;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+    for (auto&& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every item must arrive exactly once
+    const long long total = PRODUCERS * PER_PRODUCER;
+    EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+    EXPECT_FALSE(buffer.dequeue().has_value());
+}
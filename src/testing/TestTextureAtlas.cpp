@@ -0,0 +1,115 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "misc/TextureAtlas.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+    bool overlaps(const misc::TextureAtlas::Rect& a, const misc::TextureAtlas::Rect& b)
+    {
+        return a.left < b.left + b.width && b.left < a.left + a.width &&
+               a.top < b.top + b.height && b.top < a.top + a.height;
+    }
+} // namespace
+
+TEST(TextureAtlas, LayoutFitsWithoutOverlap)
+{
+    std::vector<misc::TextureAtlas::Image> images;
+    for (int i = 0; i < 30; i++)
+    {
+        images.push_back({ "text-" + std::to_string(i) + ".png", { 300, 64 } });
+    }
+    images.push_back({ "hex-large.png", { 500, 500 } });
+    images.push_back({ "hex-small.png", { 100, 100 } });
+
+    auto atlas = misc::TextureAtlas::layout(images, 1024);
+    EXPECT_EQ(atlas.getPlacements().size(), images.size());
+    EXPECT_GT(atlas.getPages().size(), 1u);
+
+    for (auto&& [name, placement] : atlas.getPlacements())
+    {
+        ASSERT_LT(placement.page, atlas.getPages().size());
+        auto page = atlas.getPages()[placement.page];
+        EXPECT_LE(page.width, 1024u);
+        EXPECT_LE(page.height, 1024u);
+        EXPECT_LE(placement.rect.left + placement.rect.width, page.width);
+        EXPECT_LE(placement.rect.top + placement.rect.height, page.height);
+
+        for (auto&& [otherName, other] : atlas.getPlacements())
+        {
+            if (name != otherName && placement.page == other.page)
+            {
+                EXPECT_FALSE(overlaps(placement.rect, other.rect)) << name << " overlaps " << otherName;
+            }
+        }
+    }
+}
+
+TEST(TextureAtlas, OversizedImageIsLeftOut)
+{
+    auto atlas = misc::TextureAtlas::layout({ { "text-wide.png", { 2048, 256 } }, { "hex.png", { 256, 256 } } }, 1024);
+
+    EXPECT_FALSE(atlas.find("text-wide.png").has_value());
+    EXPECT_TRUE(atlas.find("hex.png").has_value());
+    EXPECT_EQ(atlas.getPages().size(), 1u);
+}
+
+TEST(TextureAtlas, SerializeRoundTrip)
+{
+    auto atlas = misc::TextureAtlas::layout({ { "text-a.png", { 512, 64 } }, { "text-b.png", { 512, 64 } }, { "hex.png", { 256, 256 } } }, 512);
+    auto data = atlas.serialize();
+
+    misc::TextureAtlas loaded;
+    EXPECT_TRUE(loaded.deserialize(data));
+    ASSERT_EQ(loaded.getPages().size(), atlas.getPages().size());
+    EXPECT_EQ(loaded.getPlacements().size(), atlas.getPlacements().size());
+    for (auto&& [name, placement] : atlas.getPlacements())
+    {
+        auto found = loaded.find(name);
+        ASSERT_TRUE(found.has_value());
+        EXPECT_EQ(found->page, placement.page);
+        EXPECT_EQ(found->rect.left, placement.rect.left);
+        EXPECT_EQ(found->rect.top, placement.rect.top);
+        EXPECT_EQ(found->rect.width, placement.rect.width);
+        EXPECT_EQ(found->rect.height, placement.rect.height);
+    }
+}
+
+TEST(TextureAtlas, RejectsDamagedIndex)
+{
+    auto data = misc::TextureAtlas::layout({ { "hex.png", { 256, 256 } } }, 512).serialize();
+
+    misc::TextureAtlas truncated;
+    EXPECT_FALSE(truncated.deserialize(std::span(data).first(data.size() - 1)));
+    EXPECT_TRUE(truncated.empty());
+
+    // Move the image past the edge of its page
+    data[data.size() - 16] = std::byte{ 0xff };
+    misc::TextureAtlas outside;
+    EXPECT_FALSE(outside.deserialize(data));
+    EXPECT_TRUE(outside.empty());
+}
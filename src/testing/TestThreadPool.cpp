@@ -0,0 +1,99 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "services/ThreadPool.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <latch>
+#include <numeric>
+#include <vector>
+
+TEST(ThreadPool, ParallelForVisitsEveryIndex)
+{
+    std::vector<std::atomic_uint32_t> visits(1000);
+    ThreadPool::instance().parallelFor(visits.size(), [&visits](std::size_t index)
+                                       {
+                                           visits[index]++;
+                                       });
+
+    for (auto& count : visits)
+    {
+        EXPECT_EQ(count.load(), 1u);
+    }
+}
+
+TEST(ThreadPool, TaskGroupJoinsAllJobs)
+{
+    std::atomic_uint32_t total{ 0 };
+    ThreadPool::TaskGroup group;
+    for (std::uint32_t job = 1; job <= 100; job++)
+    {
+        group.run([&total, job]()
+                  {
+                      total += job;
+                  });
+    }
+    group.wait();
+
+    EXPECT_EQ(total.load(), 5050u);
+}
+
+// -----------------------------------------------------------------
+//
+// Every level waits on the one below it from inside of a pool task,
+// more of them than there are workers, which only completes because
+// the waiting threads help run the queued jobs.
+//
+// -----------------------------------------------------------------
+TEST(ThreadPool, NestedForkJoinFromInsideTasks)
+{
+    std::atomic_uint32_t leaves{ 0 };
+    std::latch done{ 1 };
+
+    ThreadPool::instance().enqueueTask(ThreadPool::instance().createTask(
+        [&leaves, &done]()
+        {
+            ThreadPool::TaskGroup outer;
+            for (auto branch = 0; branch < 16; branch++)
+            {
+                outer.run([&leaves]()
+                          {
+                              ThreadPool::instance().parallelFor(16, [&leaves](std::size_t)
+                                                                 {
+                                                                     ThreadPool::TaskGroup inner;
+                                                                     inner.run([&leaves]()
+                                                                               {
+                                                                                   leaves++;
+                                                                               });
+                                                                     inner.wait();
+                                                                 });
+                          });
+            }
+            outer.wait();
+            done.count_down();
+        }));
+    done.wait();
+
+    EXPECT_EQ(leaves.load(), 16u * 16u);
+}
@@ -0,0 +1,153 @@
+/*
+Copyright (c) 2022 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "misc/ContentArchive.hpp"
+#include "misc/TextureAtlas.hpp"
+
+#include <SFML/Graphics/Image.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// --------------------------------------------------------------
+//
+// The hex and text sprite sheets are what the hex grid renders, those
+// are the images packed into the atlas.
+//
+// --------------------------------------------------------------
+bool isSpriteSheet(const std::filesystem::path& file)
+{
+    auto name = file.filename().string();
+    return file.extension() == ".png" && (name.starts_with("hex-") || name.starts_with("text-"));
+}
+
+// --------------------------------------------------------------
+//
+// Lays the sprite sheets out on atlas pages and writes the page images,
+// along with the index of where each sheet is, into the staging folder
+// under the same images folder the sheets come from.
+//
+// --------------------------------------------------------------
+bool buildAtlas(const std::filesystem::path& images, const std::filesystem::path& staging)
+{
+    std::vector<std::filesystem::path> files;
+    for (auto&& entry : std::filesystem::directory_iterator(images))
+    {
+        if (entry.is_regular_file() && isSpriteSheet(entry.path()))
+        {
+            files.push_back(entry.path());
+        }
+    }
+
+    std::vector<sf::Image> sheets(files.size());
+    std::vector<misc::TextureAtlas::Image> sizes;
+    for (std::size_t i = 0; i < files.size(); i++)
+    {
+        if (!sheets[i].loadFromFile(files[i].string()))
+        {
+            std::cout << "Failure in loading " << files[i] << std::endl;
+            return false;
+        }
+        sizes.push_back({ files[i].filename().string(), { sheets[i].getSize().x, sheets[i].getSize().y } });
+    }
+
+    auto atlas = misc::TextureAtlas::layout(sizes);
+    auto folder = staging / images.filename();
+    std::filesystem::create_directories(folder / "atlas");
+
+    std::vector<sf::Image> pages(atlas.getPages().size());
+    for (std::size_t page = 0; page < pages.size(); page++)
+    {
+        pages[page].create(atlas.getPages()[page].width, atlas.getPages()[page].height, sf::Color::Transparent);
+    }
+    for (std::size_t i = 0; i < files.size(); i++)
+    {
+        if (auto placement = atlas.find(sizes[i].name))
+        {
+            pages[placement->page].copy(sheets[i], placement->rect.left, placement->rect.top);
+        }
+    }
+    for (std::size_t page = 0; page < pages.size(); page++)
+    {
+        if (!pages[page].saveToFile((folder / misc::TextureAtlas::pageName(static_cast<std::uint16_t>(page))).string()))
+        {
+            return false;
+        }
+    }
+
+    auto index = atlas.serialize();
+    std::ofstream out(folder / misc::TextureAtlas::indexName(), std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(index.data()), index.size());
+    std::cout << "Packed " << atlas.getPlacements().size() << " sprite sheets onto " << pages.size() << " atlas pages" << std::endl;
+
+    return out.good();
+}
+
+// --------------------------------------------------------------
+//
+// Offline tool that packs the content folder into a single archive
+// the game can memory map at startup, with the sprite sheets packed
+// into atlas pages.
+//
+// Usage: ContentPacker <content folder> <archive filename>
+//
+// --------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    if (argc != 3)
+    {
+        std::cout << "Usage: ContentPacker <content folder> <archive filename>" << std::endl;
+        return 1;
+    }
+
+    std::filesystem::path content(argv[1]);
+    std::filesystem::path archiveFile(argv[2]);
+    auto staging = archiveFile;
+    staging += ".atlas";
+    std::filesystem::remove_all(staging);
+    if (!buildAtlas(content / "images", staging))
+    {
+        std::cout << "Failure in building the atlas from " << (content / "images") << std::endl;
+        return 1;
+    }
+
+    bool packed = misc::ContentArchive::pack(std::vector<std::filesystem::path>{ content, staging }, archiveFile);
+    std::filesystem::remove_all(staging);
+    if (!packed)
+    {
+        std::cout << "Failure in packing " << argv[1] << " into " << argv[2] << std::endl;
+        return 1;
+    }
+
+    misc::ContentArchive archive;
+    if (!archive.open(archiveFile))
+    {
+        std::cout << "Failure in validating " << argv[2] << std::endl;
+        return 1;
+    }
+    std::cout << "Packed " << archive.size() << " files into " << argv[2] << std::endl;
+
+    return 0;
+}
@@ -38,6 +38,10 @@ namespace views
     // Each view is responsible for its own input handling, updating,
     // and rendering.
     //
+    // update is called at the fixed simulation rate, render is called once
+    // per displayed frame with the time the display is ahead of the last
+    // update, so that anything in motion can be drawn where it would be.
+    //
     // --------------------------------------------------------------
     class View
     {